@@ -1,3 +1,5 @@
+#include "container_concepts.hpp"
+
 #include <catch2/catch_test_macros.hpp>
 #include <iostream>
 #include <vector>
@@ -10,76 +12,11 @@
 
 using namespace std::literals;
 
-/*********************
-Iterator concept
-1. iterator is dereferenceable: *iter
-2. can be pre-incremented - returns reference to iterator
-3. can be post-incremented
-4. can equality comparable: supports == and !=
-**********************/
-
-/*********************
-StdContainer concept
-1. std::begin(C&) returns iterator
-2. std::end(C&) returns iterator
-3. std::size(C&) returns T convertible to size_t
-**********************/
-
-/*********************
-IndexableContainer concept
-1. is StdContainer
-2. can be indexed: c[index]
-**********************/
-
 constexpr static bool TODO = false;
 
-template <typename I>
-concept Iterator = requires(I iter) {
-    *iter;
-    { ++iter } -> std::same_as<I&>;
-    iter++;
-    iter == iter;
-    iter != iter;
-};
-
 static_assert(Iterator<int> == false);
 static_assert(Iterator<std::vector<int>::iterator>);
 
-template <typename Container>
-concept StdContainer = requires(Container& container)
-{
-    { std::begin(container) } -> Iterator;
-    { std::end(container) } -> Iterator;
-    { std::size(container) } -> std::convertible_to<size_t>;
-};
-
-template <typename T>
-struct Index
-{
-    using type = size_t;
-};
-
-template <typename T>
-concept WithKeyType = requires { typename T::key_type; };
-
-template <WithKeyType T>
-struct Index<T>
-{
-    using type = typename T::key_type;
-};
-
-template <typename T>
-using Index_t = Index<T>::type;
-
-template <typename C>
-concept Indexable = requires(C& c, Index_t<C> index)
-{   
-    c[index];
-};
-
-template <typename C>
-concept IndexableContainer = StdContainer<C> && Indexable<C>;
-
 TEST_CASE("concepts")
 {
     static_assert(StdContainer<std::vector<int>>);
@@ -101,6 +38,15 @@ TEST_CASE("concepts")
     static_assert(IndexableContainer<std::vector<bool>>);
     static_assert(IndexableContainer<std::string>);
     static_assert(IndexableContainer<decltype(arr)>);
+
+    static_assert(PositionIndexableContainer<std::vector<int>>);
+    static_assert(PositionIndexableContainer<std::vector<bool>>);
+    static_assert(PositionIndexableContainer<std::string>);
+    static_assert(PositionIndexableContainer<decltype(arr)>);
+    static_assert(!PositionIndexableContainer<std::list<int>>);
+    static_assert(!PositionIndexableContainer<std::map<int, std::string>>);
+    static_assert(!PositionIndexableContainer<std::map<size_t, std::string>>);
+    static_assert(!PositionIndexableContainer<std::unordered_map<int, int>>);
 }
 
 void print_all(const StdContainer auto& container)
@@ -114,9 +60,9 @@ void print_all(const StdContainer auto& container)
     std::cout << "\n";
 }
 
-void print_all(const IndexableContainer auto& container)
+void print_all(const PositionIndexableContainer auto& container)
 {
-    std::cout << "void print_all(const IndexableContainer auto& container)\n";
+    std::cout << "void print_all(const PositionIndexableContainer auto& container)\n";
 
     for(size_t i = 0;  i < std::size(container); ++i)
     {
@@ -0,0 +1,246 @@
+#ifndef CONTAINER_ALGORITHMS_HPP
+#define CONTAINER_ALGORITHMS_HPP
+
+#include "container_concepts.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////////////////////
+// Algorithms on StdContainer/PositionIndexableContainer
+//
+// for_each_item(c, f), reduce(c, init, op), find_if(c, pred), find(c, value), count_if(c, pred)
+//
+// Contiguous PositionIndexableContainer (std::vector, std::string, std::array, C arrays...) - loops over
+// size_t indices; for_each_item is unrolled by 4, reduce keeps 4 independent accumulators (only for ops known
+// to be associative & commutative) and find_if tests blocks of items without early exit.
+// Node-based StdContainers (std::list, std::set, std::map...) - walk that prefetches the next node
+// while the current item is processed.
+// Other containers (std::deque, std::vector<bool>) - plain iterator loops.
+//
+// Map-like containers are never indexed - their operator[] takes a key (and inserts missing items).
+
+namespace ContainerAlgorithms
+{
+    // opt-in for reduce in lanes - specialize as true for op such that op(T, item) & op(T, T) are associative
+    // & commutative and items converted to T are valid partial results
+    template <typename TOp>
+    inline constexpr bool enable_lane_reduce = false;
+
+    namespace Detail
+    {
+        inline constexpr size_t unroll_factor = 4;
+        inline constexpr size_t search_block_size = 16;
+
+        // operator[] of std::deque locates a block on every call - it is walked with iterators
+        template <typename C>
+        concept ByPosition = PositionIndexableContainer<std::remove_reference_t<C>> && std::ranges::contiguous_range<C>;
+
+        template <typename TIterator>
+        concept NodeIterator = !std::random_access_iterator<TIterator>;
+
+        template <typename C>
+        concept AnyContainer = StdContainer<std::remove_reference_t<C>>;
+
+        // + and * of integers give the same result in any order (wrap-around included)
+        template <typename TOp, typename T>
+        concept IntegralSumOrProduct = std::integral<T>
+            && (std::same_as<TOp, std::plus<>> || std::same_as<TOp, std::plus<T>> || std::same_as<TOp, std::multiplies<>>
+                || std::same_as<TOp, std::multiplies<T>>);
+
+        // the result does not depend on the order of items - lanes give the same result as a left fold
+        template <typename C, typename T, typename TOp>
+        concept ReducibleInLanes = ByPosition<C> && std::invocable<TOp&, T, T>
+            && std::convertible_to<decltype(std::declval<C&>()[size_t{}]), T>
+            && ((IntegralSumOrProduct<TOp, T> && std::integral<std::ranges::range_value_t<C>>) || enable_lane_reduce<TOp>);
+
+        // the next node is loaded while the current one is processed
+        template <typename TIterator>
+        void prefetch_next_node(const TIterator& next, const TIterator& last)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            if constexpr (std::is_lvalue_reference_v<decltype(*next)>)
+            {
+                if (next != last)
+                    __builtin_prefetch(static_cast<const void*>(std::addressof(*next)));
+            }
+#else
+            (void)next;
+            (void)last;
+#endif
+        }
+
+        template <typename C, typename F>
+        void walk(C& container, F&& f)
+        {
+            const auto last = std::end(container);
+            if constexpr (NodeIterator<std::remove_const_t<decltype(last)>>)
+            {
+                for (auto it = std::begin(container); it != last;)
+                {
+                    auto next = it;
+                    ++next;
+                    prefetch_next_node(next, last);
+                    f(*it);
+                    it = next;
+                }
+            }
+            else
+            {
+                for (auto it = std::begin(container); it != last; ++it)
+                    f(*it);
+            }
+        }
+    } // namespace Detail
+
+    ///////////////////////////
+    // traversal
+
+    template <typename C, typename F>
+        requires Detail::AnyContainer<C>
+    F for_each_item(C&& container, F f)
+    {
+        if constexpr (Detail::ByPosition<C>)
+        {
+            const size_t size = std::size(container);
+            size_t i = 0;
+            for (; i + Detail::unroll_factor <= size; i += Detail::unroll_factor)
+            {
+                f(container[i]);
+                f(container[i + 1]);
+                f(container[i + 2]);
+                f(container[i + 3]);
+            }
+            for (; i < size; ++i)
+                f(container[i]);
+        }
+        else
+            Detail::walk(container, f);
+
+        return f;
+    }
+
+    ///////////////////////////
+    // reduction
+    //
+    // Left fold with init - the same result for every container. For indexable containers items are accumulated
+    // in 4 interleaved lanes (item i goes to lane i % 4) when the order of items does not matter: std::plus or
+    // std::multiplies of integers, or op with enable_lane_reduce<TOp>.
+
+    template <typename C, typename T, typename TOp = std::plus<>>
+        requires Detail::AnyContainer<C>
+    T reduce(C&& container, T init, TOp op = {})
+    {
+        if constexpr (Detail::ReducibleInLanes<C, T, TOp>)
+        {
+            const size_t size = std::size(container);
+            if (size >= Detail::unroll_factor)
+            {
+                T accumulators[Detail::unroll_factor] = {static_cast<T>(container[0]), static_cast<T>(container[1]), static_cast<T>(container[2]), static_cast<T>(container[3])};
+
+                size_t i = Detail::unroll_factor;
+                for (; i + Detail::unroll_factor <= size; i += Detail::unroll_factor)
+                {
+                    accumulators[0] = op(std::move(accumulators[0]), container[i]);
+                    accumulators[1] = op(std::move(accumulators[1]), container[i + 1]);
+                    accumulators[2] = op(std::move(accumulators[2]), container[i + 2]);
+                    accumulators[3] = op(std::move(accumulators[3]), container[i + 3]);
+                }
+
+                init = op(std::move(init), op(op(std::move(accumulators[0]), std::move(accumulators[1])), op(std::move(accumulators[2]), std::move(accumulators[3]))));
+                for (; i < size; ++i)
+                    init = op(std::move(init), container[i]);
+                return init;
+            }
+        }
+
+        for_each_item(container, [&](const auto& item) { init = op(std::move(init), item); });
+        return init;
+    }
+
+    ///////////////////////////
+    // search
+    //
+    // For indexable containers pred is evaluated for blocks of 16 items without early exit (vectorized) -
+    // it may be called for up to 15 items past the first match.
+
+    template <typename C, typename TPredicate>
+        requires Detail::AnyContainer<C>
+    auto find_if(C&& container, TPredicate pred)
+    {
+        if constexpr (Detail::ByPosition<C>)
+        {
+            const size_t size = std::size(container);
+            size_t i = 0;
+            for (; i + Detail::search_block_size <= size; i += Detail::search_block_size)
+            {
+                unsigned found = 0;
+                for (size_t j = 0; j < Detail::search_block_size; ++j)
+                    found |= static_cast<bool>(pred(container[i + j]));
+                if (found)
+                    break;
+            }
+            for (; i < size; ++i)
+                if (pred(container[i]))
+                    break;
+
+            return std::next(std::begin(container), static_cast<std::ptrdiff_t>(i));
+        }
+        else if constexpr (std::random_access_iterator<decltype(std::begin(container))>)
+            return std::find_if(std::begin(container), std::end(container), pred);
+        else
+        {
+            const auto last = std::end(container);
+            auto it = std::begin(container);
+            while (it != last)
+            {
+                auto next = it;
+                ++next;
+                Detail::prefetch_next_node(next, last);
+                if (pred(*it))
+                    break;
+                it = next;
+            }
+            return it;
+        }
+    }
+
+    template <typename C, typename T>
+        requires Detail::AnyContainer<C>
+    auto find(C&& container, const T& value)
+    {
+        return find_if(container, [&value](const auto& item) { return item == value; });
+    }
+
+    template <typename C, typename TPredicate>
+        requires Detail::AnyContainer<C>
+    size_t count_if(C&& container, TPredicate pred)
+    {
+        if constexpr (Detail::ByPosition<C>)
+        {
+            const size_t size = std::size(container);
+            size_t count = 0;
+            for (size_t i = 0; i < size; ++i)
+                if (pred(container[i]))
+                    ++count;
+            return count;
+        }
+        else
+        {
+            size_t count = 0;
+            Detail::walk(container, [&](const auto& item) {
+                if (pred(item))
+                    ++count;
+            });
+            return count;
+        }
+    }
+} // namespace ContainerAlgorithms
+
+#endif
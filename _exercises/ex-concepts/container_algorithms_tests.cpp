@@ -0,0 +1,278 @@
+#include "container_algorithms.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <deque>
+#include <list>
+#include <map>
+#include <numeric>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace std::literals;
+
+struct BitwiseOr
+{
+    unsigned operator()(unsigned a, unsigned b) const
+    {
+        return a | b;
+    }
+};
+
+template <>
+inline constexpr bool ContainerAlgorithms::enable_lane_reduce<BitwiseOr> = true;
+
+namespace
+{
+    // list with nodes scattered in memory - traversal order differs from allocation order
+    std::list<int> make_scattered_list(const std::vector<int>& values, std::mt19937& rnd_gen)
+    {
+        std::list<int> source(values.begin(), values.end());
+        std::vector<std::list<int>::iterator> nodes;
+        for (auto it = source.begin(); it != source.end(); ++it)
+            nodes.push_back(it);
+        std::ranges::shuffle(nodes, rnd_gen);
+
+        std::list<int> scattered;
+        for (auto node : nodes)
+            scattered.splice(scattered.end(), source, node);
+        return scattered;
+    }
+} // namespace
+
+TEST_CASE("ContainerAlgorithms::for_each_item")
+{
+    SECTION("indexable - items visited in order")
+    {
+        std::vector<int> vec = {1, 2, 3, 4, 5, 6, 7};
+        std::vector<int> visited;
+        ContainerAlgorithms::for_each_item(vec, [&](int item) { visited.push_back(item); });
+        CHECK(visited == vec);
+    }
+
+    SECTION("items can be modified")
+    {
+        int arr[] = {1, 2, 3, 4, 5};
+        ContainerAlgorithms::for_each_item(arr, [](int& item) { item *= 2; });
+        CHECK(std::ranges::equal(arr, std::vector{2, 4, 6, 8, 10}));
+
+        std::list<int> lst = {1, 2, 3};
+        ContainerAlgorithms::for_each_item(lst, [](int& item) { item *= 2; });
+        CHECK(lst == std::list{2, 4, 6});
+    }
+
+    SECTION("map is walked - never indexed")
+    {
+        std::map<int, std::string> dict = {{3, "three"}, {7, "seven"}};
+        std::string text;
+        ContainerAlgorithms::for_each_item(dict, [&](const auto& kv) { text += kv.second; });
+        CHECK(text == "threeseven");
+        CHECK(dict.size() == 2); // dict[0], dict[1] would insert items
+    }
+}
+
+TEST_CASE("ContainerAlgorithms::reduce")
+{
+    std::vector<int> vec(103);
+    std::iota(vec.begin(), vec.end(), 1);
+
+    CHECK(ContainerAlgorithms::reduce(vec, 0) == 103 * 104 / 2);
+    CHECK(ContainerAlgorithms::reduce(vec, 0L) == 103L * 104 / 2);
+    CHECK(ContainerAlgorithms::reduce(std::vector{1, 2, 3}, 10) == 16); // shorter than unroll factor
+    CHECK(ContainerAlgorithms::reduce(std::deque<int>(vec.begin(), vec.end()), 0) == 103 * 104 / 2);
+    CHECK(ContainerAlgorithms::reduce(std::list<int>(vec.begin(), vec.end()), 0) == 103 * 104 / 2);
+    CHECK(ContainerAlgorithms::reduce(std::set<int>(vec.begin(), vec.end()), 0) == 103 * 104 / 2);
+    CHECK(ContainerAlgorithms::reduce(std::vector{1, 2, 3, 4, 5}, 1, std::multiplies<>{}) == 120);
+
+    SECTION("op folding items of other type than accumulator")
+    {
+        const std::unordered_map<std::string, int> counts = {{"a", 1}, {"b", 2}, {"c", 3}};
+        CHECK(ContainerAlgorithms::reduce(counts, 0, [](int total, const auto& kv) { return total + kv.second; }) == 6);
+
+        const std::vector<std::string> words = {"one", "three", "five", "seven", "eleven"};
+        CHECK(ContainerAlgorithms::reduce(words, size_t{0}, [](size_t total, const std::string& word) { return total + word.size(); }) == 23);
+    }
+
+    SECTION("strings - concatenated in order")
+    {
+        const std::vector<std::string> words = {"a", "b", "c", "d", "e", "f"};
+        CHECK(ContainerAlgorithms::reduce(words, ">"s) == ">abcdef");
+    }
+
+    SECTION("fold-style ops - the same result for vector & list")
+    {
+        const std::vector<int> billions(8, 1'000'000'000);
+        const std::list<int> billions_list(billions.begin(), billions.end());
+        const auto add_wide = [](long total, int x) { return total + x; };
+        CHECK(ContainerAlgorithms::reduce(billions, 0L, add_wide) == 8'000'000'000L);
+        CHECK(ContainerAlgorithms::reduce(billions_list, 0L, add_wide) == 8'000'000'000L);
+        CHECK(ContainerAlgorithms::reduce(billions, 0L) == 8'000'000'000L);
+
+        const std::vector<int> items = {7, 8, 9, 10, 11};
+        const std::list<int> items_list(items.begin(), items.end());
+        const auto count = [](size_t n, int) { return n + 1; };
+        CHECK(ContainerAlgorithms::reduce(items, size_t{0}, count) == 5);
+        CHECK(ContainerAlgorithms::reduce(items_list, size_t{0}, count) == 5);
+
+        const auto digits = [](int number, int digit) { return 10 * number + digit % 10; };
+        CHECK(ContainerAlgorithms::reduce(items, 0, digits) == 78901);
+        CHECK(ContainerAlgorithms::reduce(items_list, 0, digits) == 78901);
+    }
+
+    SECTION("lanes - std::plus & std::multiplies of integers, ops that opt in")
+    {
+        static_assert(ContainerAlgorithms::Detail::ReducibleInLanes<std::vector<int>&, long, std::plus<>>);
+        static_assert(ContainerAlgorithms::Detail::ReducibleInLanes<std::vector<int>&, int, std::multiplies<int>>);
+        static_assert(!ContainerAlgorithms::Detail::ReducibleInLanes<std::vector<int>&, long, std::plus<int>>); // narrows partial sums
+        static_assert(!ContainerAlgorithms::Detail::ReducibleInLanes<std::vector<double>&, double, std::plus<>>); // not associative
+        static_assert(!ContainerAlgorithms::Detail::ReducibleInLanes<std::vector<std::string>&, std::string, std::plus<>>);
+        static_assert(ContainerAlgorithms::Detail::ReducibleInLanes<std::vector<unsigned>&, unsigned, BitwiseOr>);
+        CHECK(ContainerAlgorithms::reduce(std::vector<unsigned>{1, 2, 4, 8, 16, 32}, 64u, BitwiseOr{}) == 127);
+    }
+}
+
+TEST_CASE("ContainerAlgorithms::find & count_if")
+{
+    std::vector<int> vec(50);
+    std::iota(vec.begin(), vec.end(), 0);
+
+    CHECK(ContainerAlgorithms::find(vec, 0) == vec.begin());
+    CHECK(ContainerAlgorithms::find(vec, 37) == vec.begin() + 37);
+    CHECK(ContainerAlgorithms::find(vec, 49) == vec.begin() + 49);
+    CHECK(ContainerAlgorithms::find(vec, 50) == vec.end());
+
+    const std::string text = "hello, concepts";
+    CHECK(ContainerAlgorithms::find(text, 'c') == text.begin() + 7);
+
+    const std::list<int> lst(vec.begin(), vec.end());
+    CHECK(*ContainerAlgorithms::find(lst, 42) == 42);
+    CHECK(ContainerAlgorithms::find(lst, 100) == lst.end());
+
+    const std::set<int> st(vec.begin(), vec.end());
+    CHECK(ContainerAlgorithms::find_if(st, [](int x) { return x > 45; }) == st.find(46));
+
+    const std::map<int, std::string> dict = {{1, "one"}, {2, "two"}};
+    CHECK(ContainerAlgorithms::find_if(dict, [](const auto& kv) { return kv.second == "two"; }) == dict.find(2));
+
+    const auto is_even = [](int x) { return x % 2 == 0; };
+    CHECK(ContainerAlgorithms::count_if(vec, is_even) == 25);
+    CHECK(ContainerAlgorithms::count_if(lst, is_even) == 25);
+    CHECK(ContainerAlgorithms::count_if(std::vector<bool>{true, false, true, true, false, true}, std::identity{}) == 4);
+}
+
+TEST_CASE("ContainerAlgorithms - benchmark", "[.][benchmark]")
+{
+    constexpr int n = 100'000;
+
+    std::mt19937 rnd_gen{665};
+    std::vector<int> values(n);
+    std::iota(values.begin(), values.end(), 0);
+    std::ranges::shuffle(values, rnd_gen);
+
+    const std::deque<int> dq(values.begin(), values.end());
+    const std::list<int> lst = make_scattered_list(values, rnd_gen);
+    const std::set<int> st(values.begin(), values.end());
+    const std::map<int, int> dict = [&] {
+        std::map<int, int> result;
+        for (int value : values)
+            result.emplace(value, value);
+        return result;
+    }();
+
+    const int missing = -1;
+    const auto is_multiple_of_3 = [](int x) { return x % 3 == 0; };
+
+    BENCHMARK("vector - reduce - std::accumulate")
+    {
+        return std::accumulate(values.begin(), values.end(), 0L);
+    };
+
+    BENCHMARK("vector - reduce - ContainerAlgorithms::reduce")
+    {
+        return ContainerAlgorithms::reduce(values, 0L);
+    };
+
+    BENCHMARK("vector - find - std::find")
+    {
+        return std::find(values.begin(), values.end(), missing);
+    };
+
+    BENCHMARK("vector - find - ContainerAlgorithms::find")
+    {
+        return ContainerAlgorithms::find(values, missing);
+    };
+
+    BENCHMARK("vector - count_if - std::count_if")
+    {
+        return std::count_if(values.begin(), values.end(), is_multiple_of_3);
+    };
+
+    BENCHMARK("vector - count_if - ContainerAlgorithms::count_if")
+    {
+        return ContainerAlgorithms::count_if(values, is_multiple_of_3);
+    };
+
+    BENCHMARK("deque - reduce - std::accumulate")
+    {
+        return std::accumulate(dq.begin(), dq.end(), 0L);
+    };
+
+    BENCHMARK("deque - reduce - ContainerAlgorithms::reduce")
+    {
+        return ContainerAlgorithms::reduce(dq, 0L);
+    };
+
+    BENCHMARK("deque - find - std::find")
+    {
+        return std::find(dq.begin(), dq.end(), missing);
+    };
+
+    BENCHMARK("deque - find - ContainerAlgorithms::find")
+    {
+        return ContainerAlgorithms::find(dq, missing);
+    };
+
+    BENCHMARK("list - reduce - std::accumulate")
+    {
+        return std::accumulate(lst.begin(), lst.end(), 0L);
+    };
+
+    BENCHMARK("list - reduce - ContainerAlgorithms::reduce")
+    {
+        return ContainerAlgorithms::reduce(lst, 0L);
+    };
+
+    BENCHMARK("list - find - std::find")
+    {
+        return std::find(lst.begin(), lst.end(), missing);
+    };
+
+    BENCHMARK("list - find - ContainerAlgorithms::find")
+    {
+        return ContainerAlgorithms::find(lst, missing);
+    };
+
+    BENCHMARK("set - reduce - std::accumulate")
+    {
+        return std::accumulate(st.begin(), st.end(), 0L);
+    };
+
+    BENCHMARK("set - reduce - ContainerAlgorithms::reduce")
+    {
+        return ContainerAlgorithms::reduce(st, 0L);
+    };
+
+    BENCHMARK("map - count_if - std::count_if")
+    {
+        return std::count_if(dict.begin(), dict.end(), [&](const auto& kv) { return is_multiple_of_3(kv.second); });
+    };
+
+    BENCHMARK("map - count_if - ContainerAlgorithms::count_if")
+    {
+        return ContainerAlgorithms::count_if(dict, [&](const auto& kv) { return is_multiple_of_3(kv.second); });
+    };
+}
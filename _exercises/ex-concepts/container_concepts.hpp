@@ -0,0 +1,83 @@
+#ifndef CONTAINER_CONCEPTS_HPP
+#define CONTAINER_CONCEPTS_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+
+/*********************
+Iterator concept
+1. iterator is dereferenceable: *iter
+2. can be pre-incremented - returns reference to iterator
+3. can be post-incremented
+4. can equality comparable: supports == and !=
+**********************/
+
+/*********************
+StdContainer concept
+1. std::begin(C&) returns iterator
+2. std::end(C&) returns iterator
+3. std::size(C&) returns T convertible to size_t
+**********************/
+
+/*********************
+IndexableContainer concept
+1. is StdContainer
+2. can be indexed: c[index]
+**********************/
+
+template <typename I>
+concept Iterator = requires(I iter) {
+    *iter;
+    { ++iter } -> std::same_as<I&>;
+    iter++;
+    iter == iter;
+    iter != iter;
+};
+
+template <typename Container>
+concept StdContainer = requires(Container& container)
+{
+    { std::begin(container) } -> Iterator;
+    { std::end(container) } -> Iterator;
+    { std::size(container) } -> std::convertible_to<size_t>;
+};
+
+template <typename T>
+struct Index
+{
+    using type = size_t;
+};
+
+template <typename T>
+concept WithKeyType = requires { typename T::key_type; };
+
+template <WithKeyType T>
+struct Index<T>
+{
+    using type = typename T::key_type;
+};
+
+template <typename T>
+using Index_t = Index<T>::type;
+
+template <typename C>
+concept Indexable = requires(C& c, Index_t<C> index)
+{   
+    c[index];
+};
+
+template <typename C>
+concept IndexableContainer = StdContainer<C> && Indexable<C>;
+
+/*********************
+PositionIndexableContainer concept
+1. is IndexableContainer
+2. is indexed by position: c[i] with size_t i - map-like containers with key_type are excluded
+   (for std::map<int, T> c[i] compiles, but it is a lookup by key that inserts missing items)
+**********************/
+
+template <typename C>
+concept PositionIndexableContainer = IndexableContainer<C> && !WithKeyType<C> && std::same_as<Index_t<C>, size_t>;
+
+#endif
@@ -0,0 +1,572 @@
+#ifndef FLAT_CONTAINERS_HPP
+#define FLAT_CONTAINERS_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////
+// flat_map & flat_set - sorted contiguous arrays instead of tree nodes
+//
+// FlatContainers::flat_map<std::string, int> dict(unsorted_pairs); // bulk construction: sort + dedup once
+// dict["one"] = 1;                                                  // like std::map - inserts missing key
+//
+// Keys and mapped values are stored in separate std::vectors - a lookup touches only the keys array.
+// Lookups use a branchless binary search (the loop does not depend on the comparison results, so
+// it does not suffer from mispredictions). Inserts & erases in the middle are O(n).
+//
+// Iterators of flat_map dereference to a proxy {const Key& first; T& second;} (like std::flat_map) - they model
+// std::random_access_iterator (iterator_concept), but are only input iterators for legacy algorithms.
+// The proxy converts to std::pair<Key, T> (value_type) - never the other way, so std::common_reference
+// of reference & value_type is value_type and std::ranges algorithms & views work (also for const flat_map).
+
+namespace FlatContainers
+{
+    struct sorted_unique_t
+    {
+        explicit sorted_unique_t() = default;
+    };
+
+    inline constexpr sorted_unique_t sorted_unique{};
+
+    namespace Detail
+    {
+        // index of the first key not less than key
+        template <typename TKey, typename TCompare>
+        size_t lower_bound_index(std::span<const TKey> keys, const TKey& key, const TCompare& comp)
+        {
+            size_t size = keys.size();
+            if (size == 0)
+                return 0;
+
+            const TKey* base = keys.data();
+            while (size > 1)
+            {
+                const size_t half = size / 2;
+                base = comp(base[half], key) ? base + half : base; // cmov
+                size -= half;
+            }
+
+            return static_cast<size_t>(base - keys.data()) + comp(*base, key);
+        }
+    } // namespace Detail
+
+    ///////////////////////////
+    // flat_set
+
+    template <typename TKey, typename TCompare = std::less<TKey>>
+    class flat_set
+    {
+        std::vector<TKey> keys_;
+        [[no_unique_address]] TCompare comp_;
+
+    public:
+        using key_type = TKey;
+        using value_type = TKey;
+        using key_compare = TCompare;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using reference = const TKey&;
+        using const_reference = const TKey&;
+        using iterator = typename std::vector<TKey>::const_iterator;
+        using const_iterator = iterator;
+
+        flat_set() = default;
+
+        // bulk construction from unsorted keys
+        explicit flat_set(std::vector<TKey> keys, const TCompare& comp = TCompare{})
+            : keys_{std::move(keys)}
+            , comp_{comp}
+        {
+            std::ranges::sort(keys_, comp_);
+            const auto duplicates = std::ranges::unique(keys_, [this](const TKey& a, const TKey& b) { return !comp_(a, b); });
+            keys_.erase(duplicates.begin(), duplicates.end());
+        }
+
+        template <std::ranges::input_range TRange>
+            requires(!std::same_as<std::remove_cvref_t<TRange>, flat_set>) // never hides the copy constructor
+                && std::convertible_to<std::ranges::range_reference_t<TRange>, TKey>
+        explicit flat_set(TRange&& keys, const TCompare& comp = TCompare{})
+            : flat_set(std::vector<TKey>(std::ranges::begin(keys), std::ranges::end(keys)), comp)
+        {
+        }
+
+        flat_set(std::initializer_list<TKey> keys, const TCompare& comp = TCompare{})
+            : flat_set(std::vector<TKey>(keys), comp)
+        {
+        }
+
+        flat_set(sorted_unique_t, std::vector<TKey> keys, const TCompare& comp = TCompare{})
+            : keys_{std::move(keys)}
+            , comp_{comp}
+        {
+            assert(std::ranges::adjacent_find(keys_, [this](const TKey& a, const TKey& b) { return !comp_(a, b); }) == keys_.end());
+        }
+
+        iterator begin() const
+        {
+            return keys_.begin();
+        }
+
+        iterator end() const
+        {
+            return keys_.end();
+        }
+
+        size_t size() const
+        {
+            return keys_.size();
+        }
+
+        bool empty() const
+        {
+            return keys_.empty();
+        }
+
+        void clear()
+        {
+            keys_.clear();
+        }
+
+        void reserve(size_t capacity)
+        {
+            keys_.reserve(capacity);
+        }
+
+        std::span<const TKey> keys() const
+        {
+            return keys_;
+        }
+
+        iterator lower_bound(const TKey& key) const
+        {
+            return keys_.begin() + static_cast<ptrdiff_t>(Detail::lower_bound_index(keys(), key, comp_));
+        }
+
+        iterator find(const TKey& key) const
+        {
+            const auto it = lower_bound(key);
+            return (it != end() && !comp_(key, *it)) ? it : end();
+        }
+
+        bool contains(const TKey& key) const
+        {
+            return find(key) != end();
+        }
+
+        size_t count(const TKey& key) const
+        {
+            return contains(key);
+        }
+
+        std::pair<iterator, bool> insert(TKey key)
+        {
+            const auto index = Detail::lower_bound_index(keys(), key, comp_);
+            if (index != keys_.size() && !comp_(key, keys_[index]))
+                return {keys_.begin() + static_cast<ptrdiff_t>(index), false};
+
+            return {keys_.insert(keys_.begin() + static_cast<ptrdiff_t>(index), std::move(key)), true};
+        }
+
+        size_t erase(const TKey& key)
+        {
+            const auto it = find(key);
+            if (it == end())
+                return 0;
+            keys_.erase(it);
+            return 1;
+        }
+
+        bool operator==(const flat_set& other) const
+        {
+            return keys_ == other.keys_;
+        }
+    };
+
+    ///////////////////////////
+    // flat_map
+
+    template <typename TKey, typename T, typename TCompare = std::less<TKey>>
+    class flat_map
+    {
+        std::vector<TKey> keys_;
+        std::vector<T> values_;
+        [[no_unique_address]] TCompare comp_;
+
+        template <typename TMapped>
+        struct ItemRef
+        {
+            const TKey& first;
+            TMapped& second;
+
+            operator std::pair<TKey, T>() const
+            {
+                return {first, second};
+            }
+        };
+
+        template <bool IsConst>
+        class Iterator
+        {
+            using TMapped = std::conditional_t<IsConst, const T, T>;
+
+            const TKey* key_ = nullptr;
+            TMapped* value_ = nullptr;
+
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::input_iterator_tag; // reference is a proxy
+            using value_type = std::pair<TKey, T>;
+            using difference_type = ptrdiff_t;
+            using reference = ItemRef<TMapped>;
+
+            struct pointer
+            {
+                reference ref;
+
+                reference* operator->()
+                {
+                    return &ref;
+                }
+            };
+
+            Iterator() = default;
+
+            Iterator(const TKey* key, TMapped* value)
+                : key_{key}
+                , value_{value}
+            {
+            }
+
+            template <bool OtherIsConst> // template - never hides the copy constructor
+                requires(IsConst && !OtherIsConst)
+            Iterator(const Iterator<OtherIsConst>& other)
+                : key_{other.key_}
+                , value_{other.value_}
+            {
+            }
+
+            reference operator*() const
+            {
+                return {*key_, *value_};
+            }
+
+            pointer operator->() const
+            {
+                return {**this};
+            }
+
+            reference operator[](difference_type n) const
+            {
+                return {key_[n], value_[n]};
+            }
+
+            Iterator& operator++()
+            {
+                ++key_;
+                ++value_;
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            Iterator& operator--()
+            {
+                --key_;
+                --value_;
+                return *this;
+            }
+
+            Iterator operator--(int)
+            {
+                Iterator tmp = *this;
+                --*this;
+                return tmp;
+            }
+
+            Iterator& operator+=(difference_type n)
+            {
+                key_ += n;
+                value_ += n;
+                return *this;
+            }
+
+            Iterator& operator-=(difference_type n)
+            {
+                return *this += -n;
+            }
+
+            friend Iterator operator+(Iterator it, difference_type n)
+            {
+                return it += n;
+            }
+
+            friend Iterator operator+(difference_type n, Iterator it)
+            {
+                return it += n;
+            }
+
+            friend Iterator operator-(Iterator it, difference_type n)
+            {
+                return it -= n;
+            }
+
+            friend difference_type operator-(const Iterator& a, const Iterator& b)
+            {
+                return a.key_ - b.key_;
+            }
+
+            bool operator==(const Iterator& other) const
+            {
+                return key_ == other.key_;
+            }
+
+            auto operator<=>(const Iterator& other) const
+            {
+                return key_ <=> other.key_;
+            }
+
+            friend class Iterator<!IsConst>;
+            friend class flat_map;
+        };
+
+        size_t index_of(const TKey& key) const
+        {
+            const size_t index = Detail::lower_bound_index(keys(), key, comp_);
+            return (index != keys_.size() && !comp_(key, keys_[index])) ? index : keys_.size();
+        }
+
+        Iterator<false> iterator_at(size_t index)
+        {
+            return {keys_.data() + index, values_.data() + index};
+        }
+
+        Iterator<true> iterator_at(size_t index) const
+        {
+            return {keys_.data() + index, values_.data() + index};
+        }
+
+    public:
+        using key_type = TKey;
+        using mapped_type = T;
+        using value_type = std::pair<TKey, T>;
+        using key_compare = TCompare;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+        using reference = typename iterator::reference;
+        using const_reference = typename const_iterator::reference;
+
+        flat_map() = default;
+
+        // bulk construction from unsorted pairs
+        template <std::ranges::input_range TRange>
+            requires(!std::same_as<std::remove_cvref_t<TRange>, flat_map>) // never hides the copy constructor
+                && std::convertible_to<std::ranges::range_reference_t<TRange>, std::pair<TKey, T>>
+        explicit flat_map(TRange&& items, const TCompare& comp = TCompare{})
+            : comp_{comp}
+        {
+            std::vector<std::pair<TKey, T>> sorted_items;
+            if constexpr (std::ranges::sized_range<TRange>)
+                sorted_items.reserve(std::ranges::size(items));
+            for (auto&& item : items)
+                sorted_items.push_back(static_cast<std::pair<TKey, T>>(std::forward<decltype(item)>(item)));
+
+            // stable - the first occurrence of a key wins (as for std::map::insert)
+            std::ranges::stable_sort(sorted_items, comp_, &std::pair<TKey, T>::first);
+            const auto duplicates = std::ranges::unique(sorted_items, [this](const auto& a, const auto& b) { return !comp_(a.first, b.first); });
+            sorted_items.erase(duplicates.begin(), duplicates.end());
+
+            keys_.reserve(sorted_items.size());
+            values_.reserve(sorted_items.size());
+            for (auto& [key, value] : sorted_items)
+            {
+                keys_.push_back(std::move(key));
+                values_.push_back(std::move(value));
+            }
+        }
+
+        flat_map(std::initializer_list<std::pair<TKey, T>> items, const TCompare& comp = TCompare{})
+            : flat_map(std::span{items.begin(), items.size()}, comp)
+        {
+        }
+
+        flat_map(sorted_unique_t, std::vector<TKey> keys, std::vector<T> values, const TCompare& comp = TCompare{})
+            : keys_{std::move(keys)}
+            , values_{std::move(values)}
+            , comp_{comp}
+        {
+            assert(keys_.size() == values_.size());
+            assert(std::ranges::adjacent_find(keys_, [this](const TKey& a, const TKey& b) { return !comp_(a, b); }) == keys_.end());
+        }
+
+        iterator begin()
+        {
+            return iterator_at(0);
+        }
+
+        iterator end()
+        {
+            return iterator_at(keys_.size());
+        }
+
+        const_iterator begin() const
+        {
+            return iterator_at(0);
+        }
+
+        const_iterator end() const
+        {
+            return iterator_at(keys_.size());
+        }
+
+        const_iterator cbegin() const
+        {
+            return begin();
+        }
+
+        const_iterator cend() const
+        {
+            return end();
+        }
+
+        size_t size() const
+        {
+            return keys_.size();
+        }
+
+        bool empty() const
+        {
+            return keys_.empty();
+        }
+
+        void clear()
+        {
+            keys_.clear();
+            values_.clear();
+        }
+
+        void reserve(size_t capacity)
+        {
+            keys_.reserve(capacity);
+            values_.reserve(capacity);
+        }
+
+        std::span<const TKey> keys() const
+        {
+            return keys_;
+        }
+
+        std::span<const T> values() const
+        {
+            return values_;
+        }
+
+        iterator lower_bound(const TKey& key)
+        {
+            return iterator_at(Detail::lower_bound_index(keys(), key, comp_));
+        }
+
+        const_iterator lower_bound(const TKey& key) const
+        {
+            return iterator_at(Detail::lower_bound_index(keys(), key, comp_));
+        }
+
+        iterator find(const TKey& key)
+        {
+            return iterator_at(index_of(key));
+        }
+
+        const_iterator find(const TKey& key) const
+        {
+            return iterator_at(index_of(key));
+        }
+
+        bool contains(const TKey& key) const
+        {
+            return index_of(key) != keys_.size();
+        }
+
+        size_t count(const TKey& key) const
+        {
+            return contains(key);
+        }
+
+        T& at(const TKey& key)
+        {
+            return const_cast<T&>(std::as_const(*this).at(key));
+        }
+
+        const T& at(const TKey& key) const
+        {
+            const size_t index = index_of(key);
+            if (index == keys_.size())
+                throw std::out_of_range("flat_map::at - key not found");
+            return values_[index];
+        }
+
+        template <typename... TArgs>
+        std::pair<iterator, bool> try_emplace(TKey key, TArgs&&... args)
+        {
+            const size_t index = Detail::lower_bound_index(keys(), key, comp_);
+            if (index != keys_.size() && !comp_(key, keys_[index]))
+                return {iterator_at(index), false};
+
+            keys_.insert(keys_.begin() + static_cast<ptrdiff_t>(index), std::move(key));
+            try
+            {
+                values_.emplace(values_.begin() + static_cast<ptrdiff_t>(index), std::forward<TArgs>(args)...);
+            }
+            catch (...)
+            {
+                keys_.erase(keys_.begin() + static_cast<ptrdiff_t>(index)); // keys & values stay in sync
+                throw;
+            }
+            return {iterator_at(index), true};
+        }
+
+        std::pair<iterator, bool> insert(std::pair<TKey, T> item)
+        {
+            return try_emplace(std::move(item.first), std::move(item.second));
+        }
+
+        T& operator[](const TKey& key)
+        {
+            return try_emplace(key).first->second;
+        }
+
+        size_t erase(const TKey& key)
+        {
+            const size_t index = index_of(key);
+            if (index == keys_.size())
+                return 0;
+
+            keys_.erase(keys_.begin() + static_cast<ptrdiff_t>(index));
+            values_.erase(values_.begin() + static_cast<ptrdiff_t>(index));
+            return 1;
+        }
+
+        bool operator==(const flat_map& other) const
+        {
+            return keys_ == other.keys_ && values_ == other.values_;
+        }
+    };
+} // namespace FlatContainers
+
+#endif
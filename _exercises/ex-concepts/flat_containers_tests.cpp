@@ -0,0 +1,268 @@
+#include "flat_containers.hpp"
+
+#include "container_algorithms.hpp"
+#include "container_concepts.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <map>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    struct DirectedLess
+    {
+        bool descending = false;
+
+        bool operator()(int a, int b) const
+        {
+            return descending ? b < a : a < b;
+        }
+    };
+} // namespace
+
+static_assert(StdContainer<FlatContainers::flat_map<int, std::string>>);
+static_assert(IndexableContainer<FlatContainers::flat_map<int, std::string>>);
+static_assert(IndexableContainer<FlatContainers::flat_map<std::string, std::string>>);
+static_assert(!PositionIndexableContainer<FlatContainers::flat_map<size_t, int>>);
+static_assert(std::ranges::random_access_range<FlatContainers::flat_map<int, std::string>>);
+static_assert(std::ranges::random_access_range<const FlatContainers::flat_map<int, std::string>>);
+static_assert(StdContainer<FlatContainers::flat_set<int>>);
+static_assert(!IndexableContainer<FlatContainers::flat_set<int>>); // as std::set
+
+TEST_CASE("flat_set")
+{
+    SECTION("bulk construction - sorted & deduplicated")
+    {
+        FlatContainers::flat_set<int> st{5, 3, 8, 3, 1, 5};
+        CHECK(std::ranges::equal(st, std::vector{1, 3, 5, 8}));
+        CHECK(st.size() == 4);
+    }
+
+    SECTION("lookup")
+    {
+        const FlatContainers::flat_set<std::string> words(std::vector{"one"s, "two"s, "three"s});
+        CHECK(words.contains("two"));
+        CHECK_FALSE(words.contains("four"));
+        CHECK(words.find("three") == words.begin() + 1);
+        CHECK(words.lower_bound("p") == words.begin() + 1);
+        CHECK(words.lower_bound("zzz") == words.end());
+    }
+
+    SECTION("insert & erase")
+    {
+        FlatContainers::flat_set<int> st;
+        CHECK(st.insert(3).second);
+        CHECK(st.insert(1).second);
+        CHECK_FALSE(st.insert(3).second);
+        CHECK(*st.insert(2).first == 2);
+        CHECK(std::ranges::equal(st, std::vector{1, 2, 3}));
+
+        CHECK(st.erase(2) == 1);
+        CHECK(st.erase(2) == 0);
+        CHECK(st == FlatContainers::flat_set<int>{1, 3});
+    }
+
+    SECTION("custom comparer")
+    {
+        FlatContainers::flat_set<int, std::greater<>> st{1, 3, 2};
+        CHECK(std::ranges::equal(st, std::vector{3, 2, 1}));
+        CHECK(st.contains(2));
+        CHECK(st.find(4) == st.end());
+    }
+
+    SECTION("copy of non-const set keeps stateful comparer")
+    {
+        FlatContainers::flat_set<int, DirectedLess> st({1, 3, 2}, DirectedLess{.descending = true});
+        FlatContainers::flat_set<int, DirectedLess> copy(st);
+
+        CHECK(std::ranges::equal(copy, std::vector{3, 2, 1}));
+        copy.insert(4);
+        CHECK(std::ranges::equal(copy, std::vector{4, 3, 2, 1}));
+    }
+}
+
+TEST_CASE("flat_map")
+{
+    SECTION("bulk construction - first occurrence of key wins")
+    {
+        const std::vector<std::pair<int, std::string>> items = {{3, "three"}, {1, "one"}, {3, "THREE"}, {2, "two"}};
+        const FlatContainers::flat_map<int, std::string> dict(items);
+
+        REQUIRE(dict.size() == 3);
+        CHECK(std::ranges::equal(dict.keys(), std::vector{1, 2, 3}));
+        CHECK(std::ranges::equal(dict.values(), std::vector{"one"s, "two"s, "three"s}));
+    }
+
+    SECTION("construction from std::map")
+    {
+        const std::map<std::string, int> source = {{"a", 1}, {"b", 2}};
+        const FlatContainers::flat_map<std::string, int> dict(source);
+        CHECK(dict.at("b") == 2);
+        CHECK_THROWS_AS(dict.at("c"), std::out_of_range);
+    }
+
+    SECTION("operator[] inserts missing items - like std::map")
+    {
+        FlatContainers::flat_map<std::string, int> dict = {{"one", 1}};
+        dict["three"] = 3;
+        dict["two"] = 2;
+        ++dict["one"];
+
+        CHECK(dict.size() == 3);
+        CHECK(dict["one"] == 2);
+        CHECK(std::ranges::equal(dict.keys(), std::vector{"one"s, "three"s, "two"s}));
+    }
+
+    SECTION("iteration with structured bindings")
+    {
+        FlatContainers::flat_map<int, int> dict = {{2, 20}, {1, 10}};
+        for (auto [key, value] : dict)
+            value += key;
+
+        std::vector<std::pair<int, int>> items;
+        for (const auto& [key, value] : std::as_const(dict))
+            items.emplace_back(key, value);
+        CHECK(items == std::vector<std::pair<int, int>>{{1, 11}, {2, 22}});
+    }
+
+    SECTION("std::ranges algorithms & views on const flat_map")
+    {
+        const FlatContainers::flat_map<int, std::string> dict = {{3, "three"}, {1, "one"}, {2, "two"}};
+
+        const auto it = std::ranges::find_if(dict, [](const auto& item) { return item.second == "two"; });
+        CHECK(it - dict.begin() == 1);
+        CHECK(std::ranges::equal(dict | std::views::reverse, std::vector{3, 2, 1}, {}, [](const auto& item) { return item.first; }));
+    }
+
+    SECTION("find, insert & erase")
+    {
+        FlatContainers::flat_map<int, std::string> dict;
+        CHECK(dict.insert({5, "five"}).second);
+        CHECK(dict.try_emplace(1, 3, 'a').second);
+        CHECK_FALSE(dict.insert({5, "FIVE"}).second);
+
+        auto it = dict.find(5);
+        REQUIRE(it != dict.end());
+        CHECK(it->second == "five");
+        CHECK((*dict.find(1)).second == "aaa");
+        CHECK(dict.find(3) == dict.end());
+        CHECK(dict.lower_bound(3) == it);
+
+        CHECK(dict.erase(1) == 1);
+        CHECK(dict.erase(1) == 0);
+        CHECK(dict == FlatContainers::flat_map<int, std::string>{{5, "five"}});
+    }
+
+    SECTION("copy of non-const map keeps stateful comparer")
+    {
+        FlatContainers::flat_map<int, char, DirectedLess> dict({{1, 'a'}, {3, 'c'}, {2, 'b'}}, DirectedLess{.descending = true});
+        FlatContainers::flat_map<int, char, DirectedLess> copy(dict);
+
+        CHECK(std::ranges::equal(copy.keys(), std::vector{3, 2, 1}));
+        copy[4] = 'd';
+        CHECK(std::ranges::equal(copy.keys(), std::vector{4, 3, 2, 1}));
+    }
+
+    SECTION("try_emplace - keys & values in sync when value construction throws")
+    {
+        FlatContainers::flat_map<int, std::string> dict = {{1, "one"}, {5, "five"}};
+        CHECK_THROWS_AS(dict.try_emplace(3, std::string{}.max_size() + 1, 'x'), std::length_error);
+
+        CHECK(dict.size() == 2);
+        CHECK(dict.find(3) == dict.end());
+        CHECK(dict.at(5) == "five");
+        CHECK(dict == FlatContainers::flat_map<int, std::string>{{1, "one"}, {5, "five"}});
+    }
+
+    SECTION("sorted_unique construction")
+    {
+        FlatContainers::flat_map<int, char> dict(FlatContainers::sorted_unique, {1, 2, 3}, {'a', 'b', 'c'});
+        CHECK(dict[2] == 'b');
+    }
+
+    SECTION("works with container algorithms")
+    {
+        const FlatContainers::flat_map<int, int> dict = {{1, 10}, {2, 20}, {3, 30}};
+        CHECK(ContainerAlgorithms::reduce(dict, 0, [](int total, const auto& kv) { return total + kv.second; }) == 60);
+    }
+}
+
+TEST_CASE("flat_map - benchmark", "[.][benchmark]")
+{
+    constexpr int n = 100'000;
+
+    std::mt19937 rnd_gen{665};
+    std::uniform_int_distribution<int> distr(0, 10 * n);
+
+    std::vector<std::pair<int, int>> items(n);
+    for (int i = 0; i < n; ++i)
+        items[i] = {distr(rnd_gen), i};
+
+    std::vector<int> lookup_keys(1'000);
+    for (auto& key : lookup_keys)
+        key = items[std::uniform_int_distribution<int>(0, n - 1)(rnd_gen)].first;
+
+    const std::map<int, int> std_map(items.begin(), items.end());
+    const FlatContainers::flat_map<int, int> flat_map(items);
+
+    BENCHMARK("construction - std::map")
+    {
+        return std::map<int, int>(items.begin(), items.end());
+    };
+
+    BENCHMARK("construction - flat_map (bulk)")
+    {
+        return FlatContainers::flat_map<int, int>(items);
+    };
+
+    BENCHMARK("lookup - std::map::find")
+    {
+        long sum = 0;
+        for (int key : lookup_keys)
+            sum += std_map.find(key)->second;
+        return sum;
+    };
+
+    BENCHMARK("lookup - std::lower_bound on sorted keys")
+    {
+        long sum = 0;
+        const auto keys = flat_map.keys();
+        for (int key : lookup_keys)
+            sum += flat_map.values()[static_cast<size_t>(std::lower_bound(keys.begin(), keys.end(), key) - keys.begin())];
+        return sum;
+    };
+
+    BENCHMARK("lookup - flat_map::find (branchless)")
+    {
+        long sum = 0;
+        for (int key : lookup_keys)
+            sum += flat_map.find(key)->second;
+        return sum;
+    };
+
+    BENCHMARK("iteration - std::map")
+    {
+        long sum = 0;
+        for (const auto& [key, value] : std_map)
+            sum += value;
+        return sum;
+    };
+
+    BENCHMARK("iteration - flat_map")
+    {
+        long sum = 0;
+        for (const auto& [key, value] : flat_map)
+            sum += value;
+        return sum;
+    };
+}
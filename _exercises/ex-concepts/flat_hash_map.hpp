@@ -0,0 +1,687 @@
+#ifndef FLAT_HASH_MAP_HPP
+#define FLAT_HASH_MAP_HPP
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////////////////////
+// flat_hash_map - open addressing hash map with SwissTable-style group probing
+//
+// FlatContainers::flat_hash_map<std::string, int> dict;
+// dict["one"] = 1;
+// dict.find("one"sv);          // heterogeneous lookup - no temporary std::string
+// dict.insert(pairs);          // bulk insert - reserves once
+//
+// Every slot has a control byte: empty, deleted or 7 bits of the hash (h2) for a full slot.
+// The probe sequence visits groups of 8 control bytes; a group is loaded as a single 64-bit word
+// and all 8 bytes are compared with h2 at once (SWAR - portable, no intrinsics). Keys are compared
+// only for slots with matching h2. Probing stops at the first group with an empty slot.
+// Max load factor is 7/8.
+//
+// Slots store std::pair<const Key, T> - as std::unordered_map, iterators dereference to real references
+// (for (auto& [key, value] : dict) works). Iterators are invalidated by any insert that grows the table.
+
+namespace FlatContainers
+{
+    // std::hash with heterogeneous lookup for std::string keys
+    template <typename TKey>
+    struct DefaultHash : std::hash<TKey>
+    {
+    };
+
+    template <>
+    struct DefaultHash<std::string>
+    {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view text) const
+        {
+            return std::hash<std::string_view>{}(text);
+        }
+    };
+
+    namespace Detail
+    {
+        inline constexpr size_t group_width = 8;
+        inline constexpr uint64_t lsbs = 0x0101010101010101ull;
+        inline constexpr uint64_t msbs = 0x8080808080808080ull;
+
+        inline constexpr uint8_t ctrl_empty = 0b1000'0000;
+        inline constexpr uint8_t ctrl_deleted = 0b1111'1110;
+
+        // murmur3 finalizer - h2 is taken from the low 7 bits & the probe start from the rest, so keys that
+        // differ only in high bits (std::hash of integers is the value itself) must spread over both
+        inline uint64_t mix_hash(uint64_t h)
+        {
+            h ^= h >> 33;
+            h *= 0xFF51AFD7ED558CCDull;
+            h ^= h >> 33;
+            h *= 0xC4CEB9FE1A85EC53ull;
+            h ^= h >> 33;
+            return h;
+        }
+
+        // 8 control bytes - a match is reported as bit 7 of the matching byte
+        struct Group
+        {
+            uint64_t ctrl = 0;
+
+            explicit Group(const uint8_t* position)
+            {
+                if constexpr (std::endian::native == std::endian::little)
+                    std::memcpy(&ctrl, position, group_width);
+                else
+                {
+                    for (size_t i = 0; i < group_width; ++i)
+                        ctrl |= static_cast<uint64_t>(position[i]) << (8 * i);
+                }
+            }
+
+            // may report false positives (keys are compared anyway)
+            uint64_t match(uint8_t h2) const
+            {
+                const uint64_t x = ctrl ^ (lsbs * h2);
+                return (x - lsbs) & ~x & msbs;
+            }
+
+            uint64_t match_empty() const
+            {
+                return ctrl & ~(ctrl << 6) & msbs;
+            }
+
+            uint64_t match_empty_or_deleted() const
+            {
+                return ctrl & msbs;
+            }
+
+            uint64_t match_full() const
+            {
+                return ~ctrl & msbs;
+            }
+        };
+
+        inline size_t first_match(uint64_t mask)
+        {
+            return static_cast<size_t>(std::countr_zero(mask)) / 8;
+        }
+
+        template <typename THash, typename TKeyEqual>
+        concept TransparentLookup = requires {
+            typename THash::is_transparent;
+            typename TKeyEqual::is_transparent;
+        };
+    } // namespace Detail
+
+    template <typename TKey, typename T, typename THash = DefaultHash<TKey>, typename TKeyEqual = std::equal_to<>>
+    class flat_hash_map
+    {
+        uint8_t* ctrl_ = nullptr; // capacity_ + group_width bytes - the first group is cloned at the end
+        std::pair<const TKey, T>* slots_ = nullptr;
+        size_t capacity_ = 0;
+        size_t size_ = 0;
+        size_t growth_left_ = 0;
+        [[no_unique_address]] THash hash_;
+        [[no_unique_address]] TKeyEqual key_equal_;
+
+        template <bool IsConst>
+        class Iterator
+        {
+            using TMap = std::conditional_t<IsConst, const flat_hash_map, flat_hash_map>;
+
+            TMap* map_ = nullptr;
+            size_t index_ = 0;
+
+            void skip_free_slots()
+            {
+                while (index_ < map_->capacity_)
+                {
+                    const uint64_t full = Detail::Group{map_->ctrl_ + index_}.match_full();
+                    if (full)
+                    {
+                        index_ = std::min(index_ + Detail::first_match(full), map_->capacity_); // cloned bytes are past the end
+                        return;
+                    }
+                    index_ += Detail::group_width;
+                }
+                index_ = map_->capacity_;
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::pair<const TKey, T>;
+            using difference_type = ptrdiff_t;
+            using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+            using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+
+            Iterator() = default;
+
+            Iterator(TMap* map, size_t index, bool skip = false)
+                : map_{map}
+                , index_{index}
+            {
+                if (skip)
+                    skip_free_slots();
+            }
+
+            template <bool OtherIsConst> // template - never hides the copy constructor
+                requires(IsConst && !OtherIsConst)
+            Iterator(const Iterator<OtherIsConst>& other)
+                : map_{other.map_}
+                , index_{other.index_}
+            {
+            }
+
+            reference operator*() const
+            {
+                return map_->slots_[index_];
+            }
+
+            pointer operator->() const
+            {
+                return map_->slots_ + index_;
+            }
+
+            Iterator& operator++()
+            {
+                ++index_;
+                skip_free_slots();
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            bool operator==(const Iterator& other) const
+            {
+                return index_ == other.index_;
+            }
+
+            friend class Iterator<!IsConst>;
+        };
+
+        static size_t max_size_for(size_t capacity)
+        {
+            return capacity - capacity / 8;
+        }
+
+        size_t mask() const
+        {
+            return capacity_ - 1;
+        }
+
+        void set_ctrl(size_t index, uint8_t value)
+        {
+            ctrl_[index] = value;
+            if (index < Detail::group_width)
+                ctrl_[capacity_ + index] = value;
+        }
+
+        template <typename TLookupKey>
+        uint64_t hash_of(const TLookupKey& key) const
+        {
+            return Detail::mix_hash(static_cast<uint64_t>(hash_(key)));
+        }
+
+        template <typename TLookupKey>
+        size_t find_index(const TLookupKey& key, uint64_t hash) const
+        {
+            if (capacity_ == 0)
+                return capacity_;
+
+            const auto h2 = static_cast<uint8_t>(hash & 0x7F);
+            size_t position = (hash >> 7) & mask();
+            for (size_t step = Detail::group_width;; step += Detail::group_width)
+            {
+                const Detail::Group group{ctrl_ + position};
+                for (uint64_t matches = group.match(h2); matches != 0; matches &= matches - 1)
+                {
+                    const size_t index = (position + Detail::first_match(matches)) & mask();
+                    if (key_equal_(slots_[index].first, key))
+                        return index;
+                }
+
+                if (group.match_empty())
+                    return capacity_;
+
+                position = (position + step) & mask(); // triangular probing - visits all groups
+            }
+        }
+
+        size_t find_free_slot(uint64_t hash) const
+        {
+            size_t position = (hash >> 7) & mask();
+            for (size_t step = Detail::group_width;; step += Detail::group_width)
+            {
+                const uint64_t free_slots = Detail::Group{ctrl_ + position}.match_empty_or_deleted();
+                if (free_slots)
+                    return (position + Detail::first_match(free_slots)) & mask();
+
+                position = (position + step) & mask();
+            }
+        }
+
+        void destroy_slots()
+        {
+            for (size_t i = 0; i < capacity_; ++i)
+            {
+                if (!(ctrl_[i] & 0x80))
+                    std::destroy_at(slots_ + i);
+            }
+        }
+
+        void deallocate()
+        {
+            if (capacity_ == 0)
+                return;
+
+            std::allocator<uint8_t>{}.deallocate(ctrl_, capacity_ + Detail::group_width);
+            std::allocator<std::pair<const TKey, T>>{}.deallocate(slots_, capacity_);
+            ctrl_ = nullptr;
+            slots_ = nullptr;
+        }
+
+        void rehash(size_t new_capacity)
+        {
+            flat_hash_map resized;
+            resized.ctrl_ = std::allocator<uint8_t>{}.allocate(new_capacity + Detail::group_width);
+            resized.slots_ = std::allocator<std::pair<const TKey, T>>{}.allocate(new_capacity);
+            resized.capacity_ = new_capacity;
+            std::fill_n(resized.ctrl_, new_capacity + Detail::group_width, Detail::ctrl_empty);
+
+            for (size_t i = 0; i < capacity_; ++i)
+            {
+                if (ctrl_[i] & 0x80)
+                    continue;
+
+                const uint64_t hash = hash_of(slots_[i].first);
+                const size_t index = resized.find_free_slot(hash);
+                // the moved-from key is only destroyed afterwards - as for node handles of std containers
+                std::construct_at(resized.slots_ + index, std::move(const_cast<TKey&>(slots_[i].first)), std::move(slots_[i].second));
+                resized.set_ctrl(index, static_cast<uint8_t>(hash & 0x7F));
+            }
+            resized.size_ = size_;
+            resized.growth_left_ = max_size_for(new_capacity) - size_;
+
+            std::swap(ctrl_, resized.ctrl_);
+            std::swap(slots_, resized.slots_);
+            std::swap(capacity_, resized.capacity_);
+            growth_left_ = resized.growth_left_;
+            // resized destroys moved-from items & releases the old arrays
+        }
+
+        void grow()
+        {
+            if (capacity_ == 0)
+                rehash(Detail::group_width);
+            else if (size_ * 32 <= capacity_ * 25) // many tombstones - clean them up in place
+                rehash(capacity_);
+            else
+                rehash(capacity_ * 2);
+        }
+
+        template <typename TKeyArg, typename... TArgs>
+        std::pair<size_t, bool> emplace_impl(TKeyArg&& key, TArgs&&... args)
+        {
+            const uint64_t hash = hash_of(key);
+            if (const size_t found = find_index(key, hash); found != capacity_)
+                return {found, false};
+
+            if (growth_left_ == 0)
+                grow();
+
+            const size_t index = find_free_slot(hash);
+            std::construct_at(slots_ + index, std::piecewise_construct, std::forward_as_tuple(std::forward<TKeyArg>(key)),
+                std::forward_as_tuple(std::forward<TArgs>(args)...));
+
+            if (ctrl_[index] == Detail::ctrl_empty)
+                --growth_left_;
+            set_ctrl(index, static_cast<uint8_t>(hash & 0x7F));
+            ++size_;
+            return {index, true};
+        }
+
+        void erase_at(size_t index)
+        {
+            std::destroy_at(slots_ + index);
+            --size_;
+
+            // if no window of 8 slots around index was ever full, no probe sequence passed through this slot
+            const uint64_t empty_before = Detail::Group{ctrl_ + ((index - Detail::group_width) & mask())}.match_empty();
+            const uint64_t empty_after = Detail::Group{ctrl_ + index}.match_empty();
+            const bool was_never_full = empty_before && empty_after
+                && static_cast<size_t>(std::countl_zero(empty_before) / 8 + std::countr_zero(empty_after) / 8) < Detail::group_width;
+
+            if (was_never_full)
+            {
+                set_ctrl(index, Detail::ctrl_empty);
+                ++growth_left_;
+            }
+            else
+                set_ctrl(index, Detail::ctrl_deleted);
+        }
+
+        template <typename TLookupKey>
+        const T& at_impl(const TLookupKey& key) const
+        {
+            const size_t index = find_index(key, hash_of(key));
+            if (index == capacity_)
+                throw std::out_of_range("flat_hash_map::at - key not found");
+            return slots_[index].second;
+        }
+
+        template <typename TLookupKey>
+        size_t erase_impl(const TLookupKey& key)
+        {
+            const size_t index = find_index(key, hash_of(key));
+            if (index == capacity_)
+                return 0;
+            erase_at(index);
+            return 1;
+        }
+
+    public:
+        using key_type = TKey;
+        using mapped_type = T;
+        using value_type = std::pair<const TKey, T>;
+        using hasher = THash;
+        using key_equal = TKeyEqual;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+        using reference = typename iterator::reference;
+        using const_reference = typename const_iterator::reference;
+
+        flat_hash_map() = default;
+
+        template <std::ranges::input_range TRange>
+            requires(!std::same_as<std::remove_cvref_t<TRange>, flat_hash_map>) // never hides the copy constructor
+                && std::convertible_to<std::ranges::range_reference_t<TRange>, std::pair<TKey, T>>
+        explicit flat_hash_map(TRange&& items)
+        {
+            insert(std::forward<TRange>(items));
+        }
+
+        flat_hash_map(std::initializer_list<std::pair<TKey, T>> items)
+        {
+            insert(items);
+        }
+
+        flat_hash_map(const flat_hash_map& other)
+            : hash_{other.hash_}
+            , key_equal_{other.key_equal_}
+        {
+            reserve(other.size());
+            for (const auto& [key, value] : other)
+                emplace_impl(key, value);
+        }
+
+        flat_hash_map(flat_hash_map&& other) noexcept
+            : ctrl_{std::exchange(other.ctrl_, nullptr)}
+            , slots_{std::exchange(other.slots_, nullptr)}
+            , capacity_{std::exchange(other.capacity_, 0)}
+            , size_{std::exchange(other.size_, 0)}
+            , growth_left_{std::exchange(other.growth_left_, 0)}
+            , hash_{std::move(other.hash_)}
+            , key_equal_{std::move(other.key_equal_)}
+        {
+        }
+
+        flat_hash_map& operator=(flat_hash_map other) noexcept
+        {
+            swap(other);
+            return *this;
+        }
+
+        ~flat_hash_map()
+        {
+            destroy_slots();
+            deallocate();
+        }
+
+        void swap(flat_hash_map& other) noexcept
+        {
+            std::swap(ctrl_, other.ctrl_);
+            std::swap(slots_, other.slots_);
+            std::swap(capacity_, other.capacity_);
+            std::swap(size_, other.size_);
+            std::swap(growth_left_, other.growth_left_);
+            std::swap(hash_, other.hash_);
+            std::swap(key_equal_, other.key_equal_);
+        }
+
+        iterator begin()
+        {
+            return {this, 0, true};
+        }
+
+        iterator end()
+        {
+            return {this, capacity_};
+        }
+
+        const_iterator begin() const
+        {
+            return {this, 0, true};
+        }
+
+        const_iterator end() const
+        {
+            return {this, capacity_};
+        }
+
+        size_t size() const
+        {
+            return size_;
+        }
+
+        bool empty() const
+        {
+            return size_ == 0;
+        }
+
+        size_t capacity() const
+        {
+            return capacity_;
+        }
+
+        double load_factor() const
+        {
+            return capacity_ == 0 ? 0.0 : static_cast<double>(size_) / static_cast<double>(capacity_);
+        }
+
+        void reserve(size_t count)
+        {
+            const size_t required_capacity = std::bit_ceil(std::max(Detail::group_width, count + count / 7 + 1));
+            if (required_capacity > capacity_)
+                rehash(required_capacity);
+        }
+
+        void clear()
+        {
+            destroy_slots();
+            if (capacity_ != 0)
+                std::fill_n(ctrl_, capacity_ + Detail::group_width, Detail::ctrl_empty);
+            size_ = 0;
+            growth_left_ = capacity_ == 0 ? 0 : max_size_for(capacity_);
+        }
+
+        ///////////////////////////
+        // lookup - key_type (implicit conversions as in std::unordered_map) or, for transparent hash & key_equal,
+        // any type comparable with keys
+
+        iterator find(const TKey& key)
+        {
+            return {this, find_index(key, hash_of(key))};
+        }
+
+        const_iterator find(const TKey& key) const
+        {
+            return {this, find_index(key, hash_of(key))};
+        }
+
+        bool contains(const TKey& key) const
+        {
+            return find_index(key, hash_of(key)) != capacity_;
+        }
+
+        size_t count(const TKey& key) const
+        {
+            return contains(key);
+        }
+
+        T& at(const TKey& key)
+        {
+            return const_cast<T&>(std::as_const(*this).at(key));
+        }
+
+        const T& at(const TKey& key) const
+        {
+            return at_impl(key);
+        }
+
+        template <typename TLookupKey>
+            requires Detail::TransparentLookup<THash, TKeyEqual>
+        iterator find(const TLookupKey& key)
+        {
+            return {this, find_index(key, hash_of(key))};
+        }
+
+        template <typename TLookupKey>
+            requires Detail::TransparentLookup<THash, TKeyEqual>
+        const_iterator find(const TLookupKey& key) const
+        {
+            return {this, find_index(key, hash_of(key))};
+        }
+
+        template <typename TLookupKey>
+            requires Detail::TransparentLookup<THash, TKeyEqual>
+        bool contains(const TLookupKey& key) const
+        {
+            return find_index(key, hash_of(key)) != capacity_;
+        }
+
+        template <typename TLookupKey>
+            requires Detail::TransparentLookup<THash, TKeyEqual>
+        size_t count(const TLookupKey& key) const
+        {
+            return contains(key);
+        }
+
+        template <typename TLookupKey>
+            requires Detail::TransparentLookup<THash, TKeyEqual>
+        T& at(const TLookupKey& key)
+        {
+            return const_cast<T&>(at_impl(key));
+        }
+
+        template <typename TLookupKey>
+            requires Detail::TransparentLookup<THash, TKeyEqual>
+        const T& at(const TLookupKey& key) const
+        {
+            return at_impl(key);
+        }
+
+        ///////////////////////////
+        // modifiers
+
+        template <typename... TArgs>
+        std::pair<iterator, bool> try_emplace(const TKey& key, TArgs&&... args)
+        {
+            const auto [index, inserted] = emplace_impl(key, std::forward<TArgs>(args)...);
+            return {iterator{this, index}, inserted};
+        }
+
+        template <typename... TArgs>
+        std::pair<iterator, bool> try_emplace(TKey&& key, TArgs&&... args)
+        {
+            const auto [index, inserted] = emplace_impl(std::move(key), std::forward<TArgs>(args)...);
+            return {iterator{this, index}, inserted};
+        }
+
+        std::pair<iterator, bool> insert(std::pair<TKey, T> item)
+        {
+            return try_emplace(std::move(item.first), std::move(item.second));
+        }
+
+        // bulk insert - the table grows at most once for sized ranges
+        template <std::ranges::input_range TRange>
+            requires std::convertible_to<std::ranges::range_reference_t<TRange>, std::pair<TKey, T>>
+        void insert(TRange&& items)
+        {
+            if constexpr (std::ranges::sized_range<TRange>)
+                reserve(size_ + std::ranges::size(items));
+
+            for (auto&& item : items)
+            {
+                auto [key, value] = static_cast<std::pair<TKey, T>>(std::forward<decltype(item)>(item));
+                emplace_impl(std::move(key), std::move(value));
+            }
+        }
+
+        void insert(std::initializer_list<std::pair<TKey, T>> items)
+        {
+            insert(std::span{items.begin(), items.size()});
+        }
+
+        T& operator[](const TKey& key)
+        {
+            const size_t index = emplace_impl(key).first; // may reallocate slots_
+            return slots_[index].second;
+        }
+
+        T& operator[](TKey&& key)
+        {
+            const size_t index = emplace_impl(std::move(key)).first; // may reallocate slots_
+            return slots_[index].second;
+        }
+
+        size_t erase(const TKey& key)
+        {
+            return erase_impl(key);
+        }
+
+        template <typename TLookupKey>
+            requires Detail::TransparentLookup<THash, TKeyEqual>
+        size_t erase(const TLookupKey& key)
+        {
+            return erase_impl(key);
+        }
+
+        bool operator==(const flat_hash_map& other) const
+        {
+            if (size_ != other.size_)
+                return false;
+
+            for (const auto& [key, value] : *this)
+            {
+                const auto it = other.find(key);
+                if (it == other.end() || !(it->second == value))
+                    return false;
+            }
+            return true;
+        }
+    };
+} // namespace FlatContainers
+
+#endif
@@ -0,0 +1,267 @@
+#include "flat_hash_map.hpp"
+
+#include "container_concepts.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <ranges>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace std::literals;
+
+static_assert(StdContainer<FlatContainers::flat_hash_map<int, int>>);
+static_assert(IndexableContainer<FlatContainers::flat_hash_map<int, int>>);
+static_assert(IndexableContainer<FlatContainers::flat_hash_map<std::string, std::string>>);
+static_assert(!PositionIndexableContainer<FlatContainers::flat_hash_map<size_t, int>>);
+static_assert(std::ranges::forward_range<FlatContainers::flat_hash_map<int, int>>);
+static_assert(std::ranges::forward_range<const FlatContainers::flat_hash_map<int, int>>);
+
+TEST_CASE("flat_hash_map")
+{
+    SECTION("operator[] & find")
+    {
+        FlatContainers::flat_hash_map<int, int> dict;
+        CHECK(dict.find(1) == dict.end());
+
+        for (int i = 0; i < 100; ++i)
+            dict[i] = i * i;
+        ++dict[7];
+
+        CHECK(dict.size() == 100);
+        CHECK(dict.at(7) == 50);
+        CHECK(dict.find(99)->second == 99 * 99);
+        CHECK_FALSE(dict.contains(100));
+        CHECK_THROWS_AS(dict.at(100), std::out_of_range);
+        CHECK(dict.load_factor() <= 7.0 / 8);
+    }
+
+    SECTION("insert & try_emplace do not overwrite")
+    {
+        FlatContainers::flat_hash_map<std::string, std::string> dict;
+        CHECK(dict.insert({"one", "1"}).second);
+        CHECK_FALSE(dict.insert({"one", "ONE"}).second);
+        CHECK(dict.try_emplace("two", 2, '2').second);
+        CHECK(dict.at("one") == "1");
+        CHECK(dict.at("two") == "22");
+    }
+
+    SECTION("lookup with keys converted to key_type - as std::unordered_map")
+    {
+        FlatContainers::flat_hash_map<uint64_t, int> dict = {{1, 10}, {2, 20}};
+        CHECK(dict.find(1)->second == 10);
+        CHECK(std::as_const(dict).find(2)->second == 20);
+        CHECK(dict.contains(2));
+        CHECK(dict.count(3) == 0);
+        CHECK(dict.at(1) == 10);
+        CHECK(dict.erase(1) == 1);
+        CHECK_FALSE(dict.contains(1));
+    }
+
+    SECTION("heterogeneous lookup")
+    {
+        FlatContainers::flat_hash_map<std::string, int> dict = {{"one", 1}, {"two", 2}};
+        CHECK(dict.find("one"sv)->second == 1);
+        CHECK(dict.contains("two"));
+        CHECK(dict.at("two"sv) == 2);
+        CHECK(dict.erase("one"sv) == 1);
+        CHECK(dict.size() == 1);
+    }
+
+    SECTION("bulk insert reserves once")
+    {
+        std::vector<std::pair<int, int>> items;
+        for (int i = 0; i < 1'000; ++i)
+            items.emplace_back(i, -i);
+
+        FlatContainers::flat_hash_map<int, int> dict;
+        dict.insert(items);
+        CHECK(dict.size() == 1'000);
+        CHECK(dict.capacity() == 2'048); // the smallest power of 2 with 1000 <= 7/8 * capacity
+
+        items.emplace_back(0, 42);
+        dict.insert(items); // duplicates are ignored
+        CHECK(dict.size() == 1'000);
+        CHECK(dict.at(0) == 0);
+    }
+
+    SECTION("iteration visits all items")
+    {
+        const FlatContainers::flat_hash_map<int, std::string> dict = {{1, "one"}, {2, "two"}, {3, "three"}};
+
+        std::map<int, std::string> items;
+        for (const auto& [key, value] : dict)
+            items.emplace(key, value);
+        CHECK(items == std::map<int, std::string>{{1, "one"}, {2, "two"}, {3, "three"}});
+    }
+
+    SECTION("iteration by auto& - values can be modified in place")
+    {
+        FlatContainers::flat_hash_map<int, std::string> dict = {{1, "one"}, {2, "two"}};
+
+        for (auto& [key, value] : dict)
+            value += "!";
+        CHECK(dict.at(1) == "one!");
+        CHECK(dict.at(2) == "two!");
+
+        auto found = std::ranges::find_if(std::as_const(dict), [](const auto& item) { return item.second == "two!"; });
+        CHECK(found->first == 2);
+    }
+
+    SECTION("copy & move")
+    {
+        FlatContainers::flat_hash_map<int, std::string> dict = {{1, "one"}, {2, "two"}};
+        auto copy = dict;
+        CHECK(copy == dict);
+
+        auto moved = std::move(dict);
+        CHECK(moved == copy);
+        CHECK(dict.empty()); // NOLINT - moved-from map is empty
+
+        copy.clear();
+        CHECK(copy.empty());
+        CHECK(copy.find(1) == copy.end());
+    }
+
+    SECTION("random inserts & erases - same content as std::unordered_map")
+    {
+        std::mt19937 rnd_gen{665};
+        std::uniform_int_distribution<int> key_distr(0, 2'000);
+
+        FlatContainers::flat_hash_map<int, int> dict;
+        std::unordered_map<int, int> expected;
+
+        for (int i = 0; i < 100'000; ++i)
+        {
+            const int key = key_distr(rnd_gen);
+            if (i % 3 == 0)
+                CHECK(dict.erase(key) == expected.erase(key));
+            else
+            {
+                dict[key] = i;
+                expected[key] = i;
+            }
+        }
+
+        REQUIRE(dict.size() == expected.size());
+        for (const auto& [key, value] : expected)
+            CHECK(dict.at(key) == value);
+
+        size_t count = 0;
+        for ([[maybe_unused]] const auto& item : dict)
+            ++count;
+        CHECK(count == expected.size());
+    }
+}
+
+namespace
+{
+    // lookups & erases for a table filled to the given load factor (capacity 2^17)
+    void benchmark_at_load_factor(double load_factor)
+    {
+        constexpr size_t capacity = 1 << 17;
+        const auto n = static_cast<size_t>(capacity * load_factor);
+
+        std::mt19937_64 rnd_gen{665};
+        std::vector<std::pair<uint64_t, uint64_t>> items(n);
+        for (auto& [key, value] : items)
+            key = value = rnd_gen();
+
+        std::vector<uint64_t> hits(1'000);
+        std::vector<uint64_t> misses(1'000);
+        for (size_t i = 0; i < hits.size(); ++i)
+        {
+            hits[i] = items[rnd_gen() % n].first;
+            misses[i] = rnd_gen();
+        }
+
+        FlatContainers::flat_hash_map<uint64_t, uint64_t> flat_dict;
+        flat_dict.reserve(capacity * 7 / 8 - 1);
+        flat_dict.insert(items);
+        std::unordered_map<uint64_t, uint64_t> std_dict(items.begin(), items.end());
+
+        const std::string suffix = " - load factor " + std::to_string(flat_dict.load_factor()).substr(0, 4);
+
+        BENCHMARK("insert - std::unordered_map" + suffix)
+        {
+            std::unordered_map<uint64_t, uint64_t> dict;
+            dict.reserve(n);
+            dict.insert(items.begin(), items.end());
+            return dict.size();
+        };
+
+        BENCHMARK("insert - flat_hash_map" + suffix)
+        {
+            FlatContainers::flat_hash_map<uint64_t, uint64_t> dict;
+            dict.insert(items);
+            return dict.size();
+        };
+
+        BENCHMARK("lookup hits - std::unordered_map" + suffix)
+        {
+            uint64_t sum = 0;
+            for (uint64_t key : hits)
+                sum += std_dict.find(key)->second;
+            return sum;
+        };
+
+        BENCHMARK("lookup hits - flat_hash_map" + suffix)
+        {
+            uint64_t sum = 0;
+            for (uint64_t key : hits)
+                sum += flat_dict.find(key)->second;
+            return sum;
+        };
+
+        BENCHMARK("lookup misses - std::unordered_map" + suffix)
+        {
+            size_t count = 0;
+            for (uint64_t key : misses)
+                count += std_dict.count(key);
+            return count;
+        };
+
+        BENCHMARK("lookup misses - flat_hash_map" + suffix)
+        {
+            size_t count = 0;
+            for (uint64_t key : misses)
+                count += flat_dict.count(key);
+            return count;
+        };
+
+        BENCHMARK_ADVANCED("erase & reinsert - std::unordered_map" + suffix)(Catch::Benchmark::Chronometer meter)
+        {
+            meter.measure([&] {
+                for (uint64_t key : hits)
+                {
+                    std_dict.erase(key);
+                    std_dict.emplace(key, key);
+                }
+            });
+        };
+
+        BENCHMARK_ADVANCED("erase & reinsert - flat_hash_map" + suffix)(Catch::Benchmark::Chronometer meter)
+        {
+            meter.measure([&] {
+                for (uint64_t key : hits)
+                {
+                    flat_dict.erase(key);
+                    flat_dict.try_emplace(key, key);
+                }
+            });
+        };
+    }
+} // namespace
+
+TEST_CASE("flat_hash_map - benchmark", "[.][benchmark]")
+{
+    benchmark_at_load_factor(0.25);
+    benchmark_at_load_factor(0.5);
+    benchmark_at_load_factor(0.85);
+}
@@ -0,0 +1,139 @@
+#ifndef FLOAT_ORDER_HPP
+#define FLOAT_ORDER_HPP
+
+#include "radix_sort.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////
+// IEEE total order for float & double - same results as std::strong_order
+//
+// -NaN < -inf < ... < -0.0 < +0.0 < ... < +inf < +NaN
+//
+// total_order_key(x) maps bits of x to an unsigned integer with the same order:
+//   negative values - all bits inverted, positive values - sign bit set
+// so comparisons are integer comparisons (no branches on NaN or signed zeros) and floating keys
+// can be radix sorted.
+
+namespace FloatOrder
+{
+    template <std::floating_point T>
+        requires std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8)
+    using TotalOrderKey_t = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+
+    template <std::floating_point T>
+    constexpr TotalOrderKey_t<T> total_order_key(T value)
+    {
+        using TKey = TotalOrderKey_t<T>;
+        constexpr TKey sign_bit = TKey{1} << (8 * sizeof(T) - 1);
+
+        const auto bits = std::bit_cast<TKey>(value);
+        const TKey mask = (TKey{0} - (bits >> (8 * sizeof(T) - 1))) | sign_bit;
+        return bits ^ mask;
+    }
+
+    template <std::floating_point T>
+    constexpr T from_total_order_key(TotalOrderKey_t<T> key)
+    {
+        using TKey = TotalOrderKey_t<T>;
+        constexpr TKey sign_bit = TKey{1} << (8 * sizeof(T) - 1);
+
+        const TKey mask = (TKey{0} - ((key >> (8 * sizeof(T) - 1)) ^ 1)) | sign_bit;
+        return std::bit_cast<T>(key ^ mask);
+    }
+
+    template <std::floating_point T>
+    constexpr std::strong_ordering strong_order(T a, T b)
+    {
+        return total_order_key(a) <=> total_order_key(b);
+    }
+
+    // as std::less for the total order - for std::sort, std::map, etc.
+    struct TotalOrderLess
+    {
+        template <std::floating_point T>
+        constexpr bool operator()(T a, T b) const
+        {
+            return total_order_key(a) < total_order_key(b);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // batch operations
+
+    template <std::floating_point T>
+    void total_order_keys(std::span<const T> values, std::span<TotalOrderKey_t<T>> keys)
+    {
+        assert(values.size() == keys.size());
+
+        for (size_t i = 0; i < values.size(); ++i)
+            keys[i] = total_order_key(values[i]);
+    }
+
+    // results[i] = strong_order(lhs[i], rhs[i])
+    template <std::floating_point T>
+    void strong_order(std::span<const T> lhs, std::span<const T> rhs, std::span<std::strong_ordering> results)
+    {
+        assert(lhs.size() == rhs.size() && lhs.size() == results.size());
+
+        for (size_t i = 0; i < lhs.size(); ++i)
+            results[i] = total_order_key(lhs[i]) <=> total_order_key(rhs[i]);
+    }
+
+    // number of items where lhs[i] < rhs[i] in the total order
+    template <std::floating_point T>
+    size_t count_less(std::span<const T> lhs, std::span<const T> rhs)
+    {
+        assert(lhs.size() == rhs.size());
+
+        size_t count = 0;
+        for (size_t i = 0; i < lhs.size(); ++i)
+            count += total_order_key(lhs[i]) < total_order_key(rhs[i]);
+        return count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // sorting
+
+    // values sorted as by std::strong_order - keys are radix sorted
+    template <std::ranges::contiguous_range TRng>
+        requires std::floating_point<std::ranges::range_value_t<TRng>>
+    void sort(TRng&& rng)
+    {
+        using T = std::ranges::range_value_t<TRng>;
+
+        const std::span<T> values{std::ranges::data(rng), std::ranges::size(rng)};
+        std::vector<TotalOrderKey_t<T>> keys(values.size());
+        total_order_keys(std::span<const T>{values}, std::span{keys});
+
+        RadixSort::radix_sort(keys);
+
+        for (size_t i = 0; i < values.size(); ++i)
+            values[i] = from_total_order_key<T>(keys[i]);
+    }
+
+    // items sorted (stable) by a floating key as by std::strong_order - ranges radix_sort can't sort stably
+    // (not contiguous, items not copyable) are sorted with std::ranges::stable_sort
+    template <std::ranges::random_access_range TRng, typename TProj>
+        requires std::floating_point<std::remove_cvref_t<std::invoke_result_t<TProj&, std::ranges::range_reference_t<TRng>>>>
+    void sort_by(TRng&& rng, TProj proj)
+    {
+        if constexpr (std::ranges::contiguous_range<TRng> && std::ranges::sized_range<TRng> && std::copyable<std::ranges::range_value_t<TRng>>)
+            RadixSort::radix_sort(rng, [&proj](const auto& item) { return total_order_key(std::invoke(proj, item)); });
+        else
+            std::ranges::stable_sort(rng, TotalOrderLess{}, proj);
+    }
+} // namespace FloatOrder
+
+#endif
@@ -0,0 +1,220 @@
+#include "float_order.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <compare>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    template <typename T>
+    std::vector<T> special_values()
+    {
+        using Limits = std::numeric_limits<T>;
+        using TBits = FloatOrder::TotalOrderKey_t<T>;
+
+        const T nan_with_payload = std::bit_cast<T>(std::bit_cast<TBits>(Limits::quiet_NaN()) | TBits{1});
+
+        return {Limits::quiet_NaN(), -Limits::quiet_NaN(), Limits::signaling_NaN(), -Limits::signaling_NaN(), nan_with_payload, -nan_with_payload,
+            Limits::infinity(), -Limits::infinity(), Limits::max(), Limits::lowest(), Limits::min(), -Limits::min(), Limits::denorm_min(),
+            -Limits::denorm_min(), T{0}, -T{0}, T{1}, T{-1}, T{0.5}, T{-2.5}};
+    }
+
+    // bitwise equality - tells -0.0 from 0.0 & NaNs apart
+    template <typename T>
+    bool is_same_bits(const std::vector<T>& a, const std::vector<T>& b)
+    {
+        return std::ranges::equal(a, b, [](T x, T y) { return std::bit_cast<FloatOrder::TotalOrderKey_t<T>>(x) == std::bit_cast<FloatOrder::TotalOrderKey_t<T>>(y); });
+    }
+
+    std::vector<double> random_doubles(size_t count, unsigned seed)
+    {
+        std::mt19937_64 rnd_gen{seed};
+        std::uniform_real_distribution<double> distr(-1e6, 1e6);
+
+        const auto specials = special_values<double>();
+        std::vector<double> values(count);
+        for (size_t i = 0; i < count; ++i)
+            values[i] = (i % 16 == 0) ? specials[rnd_gen() % specials.size()] : distr(rnd_gen);
+        return values;
+    }
+
+    struct Gadget
+    {
+        std::string name;
+        double price;
+    };
+} // namespace
+
+TEST_CASE("total order key - same order as std::strong_order")
+{
+    SECTION("double")
+    {
+        const auto values = special_values<double>();
+        for (double a : values)
+        {
+            CHECK(std::bit_cast<uint64_t>(FloatOrder::from_total_order_key<double>(FloatOrder::total_order_key(a))) == std::bit_cast<uint64_t>(a));
+
+            for (double b : values)
+                CHECK(FloatOrder::strong_order(a, b) == std::strong_order(a, b));
+        }
+    }
+
+    SECTION("float")
+    {
+        const auto values = special_values<float>();
+        for (float a : values)
+        {
+            CHECK(std::bit_cast<uint32_t>(FloatOrder::from_total_order_key<float>(FloatOrder::total_order_key(a))) == std::bit_cast<uint32_t>(a));
+
+            for (float b : values)
+                CHECK(FloatOrder::strong_order(a, b) == std::strong_order(a, b));
+        }
+    }
+
+    SECTION("-0.0 < 0.0 & NaN has a place")
+    {
+        CHECK(FloatOrder::TotalOrderLess{}(-0.0, 0.0));
+        CHECK(FloatOrder::TotalOrderLess{}(std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN()));
+        CHECK(FloatOrder::TotalOrderLess{}(-std::numeric_limits<double>::quiet_NaN(), -std::numeric_limits<double>::infinity()));
+        CHECK(std::is_eq(FloatOrder::strong_order(std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN())));
+    }
+
+    static_assert(FloatOrder::total_order_key(-1.0) < FloatOrder::total_order_key(1.0));
+}
+
+TEST_CASE("total order - batch operations")
+{
+    const auto lhs = random_doubles(1'000, 1);
+    const auto rhs = random_doubles(1'000, 2);
+
+    std::vector<std::strong_ordering> results(lhs.size(), std::strong_ordering::equal);
+    FloatOrder::strong_order(std::span{lhs}, std::span{rhs}, std::span{results});
+
+    size_t expected_count_less = 0;
+    for (size_t i = 0; i < lhs.size(); ++i)
+    {
+        CHECK(results[i] == std::strong_order(lhs[i], rhs[i]));
+        expected_count_less += std::strong_order(lhs[i], rhs[i]) < 0;
+    }
+
+    CHECK(FloatOrder::count_less(std::span{lhs}, std::span{rhs}) == expected_count_less);
+}
+
+TEST_CASE("total order - sorting")
+{
+    const auto strong_less = [](auto a, auto b) { return std::strong_order(a, b) < 0; };
+
+    SECTION("double")
+    {
+        auto values = random_doubles(10'000, 665);
+        auto expected = values;
+        std::ranges::sort(expected, strong_less);
+
+        FloatOrder::sort(values);
+        CHECK(is_same_bits(values, expected));
+    }
+
+    SECTION("float")
+    {
+        std::vector<float> values;
+        for (double value : random_doubles(10'000, 42))
+            values.push_back(static_cast<float>(value));
+        auto expected = values;
+        std::ranges::sort(expected, strong_less);
+
+        FloatOrder::sort(values);
+        CHECK(is_same_bits(values, expected));
+    }
+
+    SECTION("items by floating key - stable")
+    {
+        std::vector<Gadget> gadgets;
+        const auto prices = random_doubles(1'000, 7);
+        for (size_t i = 0; i < prices.size(); ++i)
+            gadgets.push_back(Gadget{std::to_string(i), prices[i] * static_cast<double>(i % 2)}); // many -0.0 & 0.0
+
+        auto expected = gadgets;
+        std::ranges::stable_sort(expected, strong_less, &Gadget::price);
+
+        FloatOrder::sort_by(gadgets, &Gadget::price);
+        CHECK(std::ranges::equal(gadgets, expected, {}, &Gadget::name, &Gadget::name));
+    }
+
+    SECTION("items by floating key in a deque - stable")
+    {
+        std::deque<Gadget> gadgets;
+        for (size_t i = 0; i < 200; ++i)
+            gadgets.push_back(Gadget{std::to_string(i), static_cast<double>(i % 3) - 1.0}); // 3 keys - long runs of equal prices
+
+        auto expected = gadgets;
+        std::ranges::stable_sort(expected, strong_less, &Gadget::price);
+
+        FloatOrder::sort_by(gadgets, &Gadget::price);
+        CHECK(std::ranges::equal(gadgets, expected, {}, &Gadget::name, &Gadget::name));
+    }
+}
+
+TEST_CASE("total order - benchmark", "[.][benchmark]")
+{
+    const auto lhs = random_doubles(1'000'000, 1);
+    const auto rhs = random_doubles(1'000'000, 2);
+    std::vector<std::strong_ordering> results(lhs.size(), std::strong_ordering::equal);
+
+    BENCHMARK("strong_order - std::strong_order")
+    {
+        for (size_t i = 0; i < lhs.size(); ++i)
+            results[i] = std::strong_order(lhs[i], rhs[i]);
+        return results.back();
+    };
+
+    BENCHMARK("strong_order - FloatOrder::strong_order (batch)")
+    {
+        FloatOrder::strong_order(std::span{lhs}, std::span{rhs}, std::span{results});
+        return results.back();
+    };
+
+    BENCHMARK("count less - std::strong_order")
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < lhs.size(); ++i)
+            count += std::strong_order(lhs[i], rhs[i]) < 0;
+        return count;
+    };
+
+    BENCHMARK("count less - FloatOrder::count_less")
+    {
+        return FloatOrder::count_less(std::span{lhs}, std::span{rhs});
+    };
+
+    BENCHMARK("sort - std::sort with std::strong_order")
+    {
+        auto values = lhs;
+        std::sort(values.begin(), values.end(), [](double a, double b) { return std::strong_order(a, b) < 0; });
+        return values;
+    };
+
+    BENCHMARK("sort - std::sort with TotalOrderLess")
+    {
+        auto values = lhs;
+        std::sort(values.begin(), values.end(), FloatOrder::TotalOrderLess{});
+        return values;
+    };
+
+    BENCHMARK("sort - FloatOrder::sort (radix)")
+    {
+        auto values = lhs;
+        FloatOrder::sort(values);
+        return values;
+    };
+}
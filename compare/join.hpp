@@ -0,0 +1,294 @@
+#ifndef JOIN_HPP
+#define JOIN_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////
+// Equi-joins of two ranges
+//
+// auto human_key = [](const Human& h) { return std::tie(h.name, h.how_old); };
+// auto person_key = [](const Person& p) { return std::tie(p.name, p.age); };
+//
+// auto rows = Joins::hash_join(humans, people, human_key, person_key); // pairs of indexes: humans[row.left] == people[row.right]
+//
+// Keys (projections) are used for hashing & ordering only, matches are confirmed with the equality
+// predicate of items - by default the heterogeneous operator==(const Human&, const Person&).
+//
+// hash_join            - hash table built on the left range & probed with the right one: O(n + m)
+// sort_merge_join      - indexes of both ranges sorted by keys & merged: O(n log n + m log m), no hashing
+// parallel_hash_join   - both ranges partitioned by hash, partitions joined by threads
+//
+// Rows are returned in an unspecified order.
+
+namespace Joins
+{
+    struct RowPair
+    {
+        size_t left;
+        size_t right;
+
+        auto operator<=>(const RowPair&) const = default;
+    };
+
+    // hash of keys - the same for equal keys of different types (e.g. std::string & std::string_view, tuples of references)
+    struct KeyHash
+    {
+        template <typename TKey>
+        size_t operator()(const TKey& key) const
+        {
+            return finalize(hash_of(key));
+        }
+
+    private:
+        template <typename TKey>
+        static size_t hash_of(const TKey& key)
+        {
+            if constexpr (requires { std::tuple_size<TKey>::value; })
+            {
+                return std::apply(
+                    [](const auto&... items) {
+                        size_t seed = 0;
+                        ((seed = (seed ^ hash_of(items)) * 0x9E3779B97F4A7C15ULL), ...);
+                        return seed;
+                    },
+                    key);
+            }
+            else if constexpr (std::convertible_to<const TKey&, std::string_view>)
+                return std::hash<std::string_view>{}(key);
+            else
+                return std::hash<TKey>{}(key);
+        }
+
+        // murmur3 finalizer - partitions take the top bits & buckets the bottom bits, so sequential ids
+        // (hashed by std::hash as themselves) must not leave either end constant
+        static size_t finalize(uint64_t hash)
+        {
+            hash ^= hash >> 33;
+            hash *= 0xFF51AFD7ED558CCDULL;
+            hash ^= hash >> 33;
+            hash *= 0xC4CEB9FE1A85EC53ULL;
+            hash ^= hash >> 33;
+            return static_cast<size_t>(hash);
+        }
+    };
+
+    namespace Detail
+    {
+        constexpr uint32_t end_of_chain = ~uint32_t{0};
+
+        // chained hash table over indexes of build rows - heads & links in flat arrays
+        template <typename TLeftRng, typename TRightRng, typename TEqual>
+        void join_indexes(const TLeftRng& left, const std::vector<size_t>& left_hashes, std::span<const uint32_t> left_rows,
+            const TRightRng& right, const std::vector<size_t>& right_hashes, std::span<const uint32_t> right_rows,
+            TEqual& equal, std::vector<RowPair>& result)
+        {
+            if (left_rows.empty() || right_rows.empty())
+                return;
+
+            const size_t buckets_count = std::bit_ceil(left_rows.size());
+            const size_t mask = buckets_count - 1;
+
+            std::vector<uint32_t> heads(buckets_count, end_of_chain);
+            std::vector<uint32_t> next(left_rows.size());
+            for (size_t i = 0; i < left_rows.size(); ++i)
+            {
+                const size_t bucket = left_hashes[left_rows[i]] & mask;
+                next[i] = heads[bucket];
+                heads[bucket] = static_cast<uint32_t>(i);
+            }
+
+            for (const uint32_t right_row : right_rows)
+            {
+                const size_t hash = right_hashes[right_row];
+                for (uint32_t i = heads[hash & mask]; i != end_of_chain; i = next[i])
+                {
+                    const uint32_t left_row = left_rows[i];
+                    if (left_hashes[left_row] == hash && std::invoke(equal, left[left_row], right[right_row]))
+                        result.push_back(RowPair{left_row, right_row});
+                }
+            }
+        }
+
+        inline std::vector<uint32_t> all_rows(size_t size)
+        {
+            std::vector<uint32_t> rows(size);
+            std::iota(rows.begin(), rows.end(), uint32_t{0});
+            return rows;
+        }
+    } // namespace Detail
+
+    template <typename TLeftRng, typename TRightRng, typename TLeftKey, typename TRightKey>
+    concept Joinable = std::ranges::random_access_range<TLeftRng> && std::ranges::sized_range<TLeftRng>
+        && std::ranges::random_access_range<TRightRng> && std::ranges::sized_range<TRightRng>
+        && std::invocable<TLeftKey&, std::ranges::range_reference_t<const TLeftRng>>
+        && std::invocable<TRightKey&, std::ranges::range_reference_t<const TRightRng>>;
+
+    template <typename TLeftRng, typename TRightRng, typename TLeftKey, typename TRightKey, typename TEqual = std::equal_to<>>
+        requires Joinable<TLeftRng, TRightRng, TLeftKey, TRightKey>
+    std::vector<RowPair> hash_join(const TLeftRng& left, const TRightRng& right, TLeftKey left_key, TRightKey right_key, TEqual equal = {})
+    {
+        const size_t left_size = std::ranges::size(left);
+        const size_t right_size = std::ranges::size(right);
+        assert(left_size < Detail::end_of_chain && right_size < Detail::end_of_chain);
+
+        std::vector<size_t> left_hashes(left_size);
+        std::vector<size_t> right_hashes(right_size);
+        for (size_t i = 0; i < left_size; ++i)
+            left_hashes[i] = KeyHash{}(std::invoke(left_key, left[i]));
+        for (size_t i = 0; i < right_size; ++i)
+            right_hashes[i] = KeyHash{}(std::invoke(right_key, right[i]));
+
+        const auto left_rows = Detail::all_rows(left_size);
+        const auto right_rows = Detail::all_rows(right_size);
+
+        std::vector<RowPair> result;
+        result.reserve(std::max(left_size, right_size));
+        Detail::join_indexes(left, left_hashes, left_rows, right, right_hashes, right_rows, equal, result);
+
+        return result;
+    }
+
+    // keys of both ranges must be comparable with <=> (e.g. std::tie of members)
+    template <typename TLeftRng, typename TRightRng, typename TLeftKey, typename TRightKey, typename TEqual = std::equal_to<>>
+        requires Joinable<TLeftRng, TRightRng, TLeftKey, TRightKey>
+    std::vector<RowPair> sort_merge_join(const TLeftRng& left, const TRightRng& right, TLeftKey left_key, TRightKey right_key, TEqual equal = {})
+    {
+        auto left_rows = Detail::all_rows(std::ranges::size(left));
+        auto right_rows = Detail::all_rows(std::ranges::size(right));
+
+        std::ranges::sort(left_rows, [&](uint32_t a, uint32_t b) { return std::invoke(left_key, left[a]) < std::invoke(left_key, left[b]); });
+        std::ranges::sort(right_rows, [&](uint32_t a, uint32_t b) { return std::invoke(right_key, right[a]) < std::invoke(right_key, right[b]); });
+
+        std::vector<RowPair> result;
+        result.reserve(std::max(left_rows.size(), right_rows.size()));
+
+        size_t l = 0;
+        size_t r = 0;
+        while (l < left_rows.size() && r < right_rows.size())
+        {
+            const auto cmp = std::invoke(left_key, left[left_rows[l]]) <=> std::invoke(right_key, right[right_rows[r]]);
+            if (cmp < 0)
+                ++l;
+            else if (cmp > 0)
+                ++r;
+            else
+            {
+                // runs of equal keys on both sides - cross product
+                size_t l_end = l + 1;
+                while (l_end < left_rows.size() && std::is_eq(std::invoke(left_key, left[left_rows[l_end]]) <=> std::invoke(right_key, right[right_rows[r]])))
+                    ++l_end;
+                size_t r_end = r + 1;
+                while (r_end < right_rows.size() && std::is_eq(std::invoke(left_key, left[left_rows[l]]) <=> std::invoke(right_key, right[right_rows[r_end]])))
+                    ++r_end;
+
+                for (size_t i = l; i < l_end; ++i)
+                    for (size_t j = r; j < r_end; ++j)
+                        if (std::invoke(equal, left[left_rows[i]], right[right_rows[j]]))
+                            result.push_back(RowPair{left_rows[i], right_rows[j]});
+
+                l = l_end;
+                r = r_end;
+            }
+        }
+
+        return result;
+    }
+
+    // partitions of both ranges by the highest bits of hashes (buckets use the lowest bits) - each fits in cache
+    template <typename TLeftRng, typename TRightRng, typename TLeftKey, typename TRightKey, typename TEqual = std::equal_to<>>
+        requires Joinable<TLeftRng, TRightRng, TLeftKey, TRightKey>
+    std::vector<RowPair> parallel_hash_join(const TLeftRng& left, const TRightRng& right, TLeftKey left_key, TRightKey right_key, TEqual equal = {},
+        unsigned threads_count = std::max(1u, std::thread::hardware_concurrency()))
+    {
+        threads_count = std::max(1u, threads_count);
+
+        constexpr size_t partition_bits = 6;
+        constexpr size_t partitions_count = size_t{1} << partition_bits;
+        const auto partition_of = [](size_t hash) { return hash >> (8 * sizeof(size_t) - partition_bits); };
+
+        const size_t left_size = std::ranges::size(left);
+        const size_t right_size = std::ranges::size(right);
+        assert(left_size < Detail::end_of_chain && right_size < Detail::end_of_chain);
+
+        // phase 1: hashes & partitions of chunks
+        std::vector<size_t> left_hashes(left_size);
+        std::vector<size_t> right_hashes(right_size);
+        std::vector<std::vector<std::vector<uint32_t>>> left_chunk_partitions(threads_count, std::vector<std::vector<uint32_t>>(partitions_count));
+        std::vector<std::vector<std::vector<uint32_t>>> right_chunk_partitions(threads_count, std::vector<std::vector<uint32_t>>(partitions_count));
+        {
+            const auto partition_chunk = [&](const auto& rng, auto& key, size_t size, size_t chunk, std::vector<size_t>& hashes, auto& partitions) {
+                const size_t first = size * chunk / threads_count;
+                const size_t last = size * (chunk + 1) / threads_count;
+                for (size_t i = first; i < last; ++i)
+                {
+                    hashes[i] = KeyHash{}(std::invoke(key, rng[i]));
+                    partitions[partition_of(hashes[i])].push_back(static_cast<uint32_t>(i));
+                }
+            };
+
+            std::vector<std::jthread> threads;
+            for (size_t chunk = 0; chunk < threads_count; ++chunk)
+            {
+                threads.emplace_back([&, chunk] {
+                    partition_chunk(left, left_key, left_size, chunk, left_hashes, left_chunk_partitions[chunk]);
+                    partition_chunk(right, right_key, right_size, chunk, right_hashes, right_chunk_partitions[chunk]);
+                });
+            }
+        }
+
+        // phase 2: partitions are disjoint - joined independently, taken by threads one by one
+        std::vector<std::vector<RowPair>> partition_results(partitions_count);
+        std::atomic<size_t> next_partition{0};
+        {
+            const auto gather = [](const auto& chunk_partitions, size_t partition) {
+                std::vector<uint32_t> rows;
+                for (const auto& partitions : chunk_partitions)
+                    rows.insert(rows.end(), partitions[partition].begin(), partitions[partition].end());
+                return rows;
+            };
+
+            std::vector<std::jthread> threads;
+            for (size_t thread = 0; thread < threads_count; ++thread)
+            {
+                threads.emplace_back([&] {
+                    TEqual local_equal = equal;
+                    for (size_t partition = next_partition++; partition < partitions_count; partition = next_partition++)
+                    {
+                        const auto left_rows = gather(left_chunk_partitions, partition);
+                        const auto right_rows = gather(right_chunk_partitions, partition);
+                        Detail::join_indexes(left, left_hashes, left_rows, right, right_hashes, right_rows, local_equal, partition_results[partition]);
+                    }
+                });
+            }
+        }
+
+        std::vector<RowPair> result;
+        size_t result_size = 0;
+        for (const auto& rows : partition_results)
+            result_size += rows.size();
+        result.reserve(result_size);
+        for (const auto& rows : partition_results)
+            result.insert(result.end(), rows.begin(), rows.end());
+
+        return result;
+    }
+} // namespace Joins
+
+#endif
@@ -0,0 +1,160 @@
+#include "join.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <compare>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace std::literals;
+
+using Joins::RowPair;
+
+namespace
+{
+    struct Person
+    {
+        std::string name;
+        int age;
+        std::string nick;
+
+        auto operator<=>(const Person&) const = default;
+    };
+
+    // as in comparisons.cpp - equal to Person on (name, age)
+    struct Human
+    {
+        std::string name;
+        int how_old;
+        double height;
+
+        bool operator==(const Person& other) const
+        {
+            return std::tie(name, how_old) == std::tie(other.name, other.age);
+        }
+    };
+
+    auto human_key = [](const Human& h) { return std::tie(h.name, h.how_old); };
+    auto person_key = [](const Person& p) { return std::tie(p.name, p.age); };
+
+    std::vector<RowPair> nested_loop_join(const std::vector<Human>& humans, const std::vector<Person>& people)
+    {
+        std::vector<RowPair> rows;
+        for (size_t i = 0; i < humans.size(); ++i)
+            for (size_t j = 0; j < people.size(); ++j)
+                if (humans[i] == people[j])
+                    rows.push_back(RowPair{i, j});
+        return rows;
+    }
+
+    std::vector<RowPair> sorted(std::vector<RowPair> rows)
+    {
+        std::ranges::sort(rows);
+        return rows;
+    }
+
+    // names_count controls the number of matches - (name, age) pairs repeat on both sides
+    std::pair<std::vector<Human>, std::vector<Person>> random_humans_and_people(size_t humans_count, size_t people_count, int names_count, unsigned seed)
+    {
+        std::mt19937 rnd_gen{seed};
+        std::uniform_int_distribution<int> name_distr(0, names_count - 1);
+        std::uniform_int_distribution<int> age_distr(20, 23);
+
+        std::vector<Human> humans(humans_count);
+        for (auto& h : humans)
+            h = Human{"Name" + std::to_string(name_distr(rnd_gen)), age_distr(rnd_gen), 170.0};
+
+        std::vector<Person> people(people_count);
+        for (auto& p : people)
+            p = Person{"Name" + std::to_string(name_distr(rnd_gen)), age_distr(rnd_gen), "nick"};
+
+        return {std::move(humans), std::move(people)};
+    }
+} // namespace
+
+TEST_CASE("joins - Human & Person on (name, age)")
+{
+    const std::vector<Human> humans = {{"Eva", 33, 167.6}, {"Adam", 40, 180.0}, {"Eva", 32, 167.6}, {"Eva", 33, 170.0}};
+    const std::vector<Person> people = {{"Eva", 33, "E"}, {"John", 40, "J"}, {"Adam", 40, "A"}, {"Eva", 33, "Evie"}};
+
+    const std::vector<RowPair> expected = {{0, 0}, {0, 3}, {1, 2}, {3, 0}, {3, 3}};
+
+    CHECK(sorted(Joins::hash_join(humans, people, human_key, person_key)) == expected);
+    CHECK(sorted(Joins::sort_merge_join(humans, people, human_key, person_key)) == expected);
+    CHECK(sorted(Joins::parallel_hash_join(humans, people, human_key, person_key, std::equal_to<>{}, 2)) == expected);
+
+    SECTION("custom predicate - filters matches with equal keys")
+    {
+        auto tall_enough = [](const Human& h, const Person& p) { return h == p && h.height > 168.0; };
+        const std::vector<RowPair> expected_tall = {{1, 2}, {3, 0}, {3, 3}};
+
+        CHECK(sorted(Joins::hash_join(humans, people, human_key, person_key, tall_enough)) == expected_tall);
+        CHECK(sorted(Joins::sort_merge_join(humans, people, human_key, person_key, tall_enough)) == expected_tall);
+        CHECK(sorted(Joins::parallel_hash_join(humans, people, human_key, person_key, tall_enough, 3)) == expected_tall);
+    }
+
+    SECTION("empty ranges")
+    {
+        CHECK(Joins::hash_join(std::vector<Human>{}, people, human_key, person_key).empty());
+        CHECK(Joins::sort_merge_join(humans, std::vector<Person>{}, human_key, person_key).empty());
+        CHECK(Joins::parallel_hash_join(std::vector<Human>{}, std::vector<Person>{}, human_key, person_key).empty());
+    }
+}
+
+TEST_CASE("joins - same rows as nested loops")
+{
+    for (int names_count : {1, 10, 1'000})
+    {
+        const auto [humans, people] = random_humans_and_people(700, 500, names_count, static_cast<unsigned>(names_count));
+        const auto expected = nested_loop_join(humans, people);
+
+        DYNAMIC_SECTION("names: " << names_count)
+        {
+            CHECK(sorted(Joins::hash_join(humans, people, human_key, person_key)) == expected);
+            CHECK(sorted(Joins::sort_merge_join(humans, people, human_key, person_key)) == expected);
+            for (unsigned threads_count : {0u, 1u, 3u, 8u}) // 0 - as 1 thread
+                CHECK(sorted(Joins::parallel_hash_join(humans, people, human_key, person_key, std::equal_to<>{}, threads_count)) == expected);
+        }
+    }
+}
+
+TEST_CASE("KeyHash - same for equal keys of different types")
+{
+    const std::string name = "Eva";
+    const int age = 33;
+
+    CHECK(Joins::KeyHash{}(name) == Joins::KeyHash{}("Eva"sv));
+    CHECK(Joins::KeyHash{}(std::tie(name, age)) == Joins::KeyHash{}(std::tuple{"Eva"sv, 33}));
+    CHECK(Joins::KeyHash{}(std::tuple{"Eva"sv, 33}) != Joins::KeyHash{}(std::tuple{"Eva"sv, 32}));
+}
+
+TEST_CASE("joins - benchmark", "[.][benchmark]")
+{
+    // 10^6 x 10^6 - about one match per row
+    const auto [humans, people] = random_humans_and_people(1'000'000, 1'000'000, 1'000'000 / 4, 665);
+
+    BENCHMARK("nested loops - 10^4 x 10^4")
+    {
+        const std::vector<Human> some_humans(humans.begin(), humans.begin() + 10'000);
+        const std::vector<Person> some_people(people.begin(), people.begin() + 10'000);
+        return nested_loop_join(some_humans, some_people).size();
+    };
+
+    BENCHMARK("hash_join - 10^6 x 10^6")
+    {
+        return Joins::hash_join(humans, people, human_key, person_key).size();
+    };
+
+    BENCHMARK("sort_merge_join - 10^6 x 10^6")
+    {
+        return Joins::sort_merge_join(humans, people, human_key, person_key).size();
+    };
+
+    BENCHMARK("parallel_hash_join - 10^6 x 10^6")
+    {
+        return Joins::parallel_hash_join(humans, people, human_key, person_key).size();
+    };
+}
@@ -0,0 +1,235 @@
+#ifndef NORMALIZED_KEY_HPP
+#define NORMALIZED_KEY_HPP
+
+#include "float_order.hpp"
+#include "radix_sort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////
+// Normalized (memcmp-comparable) keys
+//
+// NormalizedKey<32> key{person.name, person.age, person.nick}; // members in the order of <=>
+//
+// Members are encoded into a fixed-width byte array, so comparing two keys with memcmp gives the
+// same order as a lexicographic comparison of the members:
+//   - integers  -> big-endian RadixSort key (the sign bit of signed values flipped)
+//   - enums     -> underlying integer
+//   - floats    -> big-endian FloatOrder::total_order_key (IEEE total order, as std::strong_order)
+//   - PartialOrder{float} -> as floats, but -0.0 encoded as +0.0 - for members compared with a defaulted <=>
+//                    (std::partial_ordering: -0.0 == +0.0); NaN has no place in that order and must not be used
+//   - strings   -> bytes with 0x00 escaped as 0x00 0xFF, terminated by 0x00 0x00 (a prefix sorts first)
+//
+// Members that do not fit are cut off and the key is marked as truncated - when two keys compare
+// equal and one of them is truncated, the objects must be compared with <=>.
+// sort_by_normalized_key & lower_bound_by_normalized_key do it - their results match the <=> order
+// if float members are encoded the way <=> compares them: plain for std::strong_order,
+// PartialOrder{member} for a defaulted <=>.
+
+namespace NormalizedKeys
+{
+    template <std::floating_point T>
+    struct PartialOrder
+    {
+        T value;
+    };
+
+    template <typename T>
+    struct IsPartialOrder : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct IsPartialOrder<PartialOrder<T>> : std::true_type
+    {
+    };
+
+    template <typename T>
+    concept KeyMember = std::integral<T> || std::is_enum_v<T> || std::floating_point<T> || IsPartialOrder<T>::value
+        || std::convertible_to<const T&, std::string_view>;
+
+    template <size_t N>
+    class NormalizedKey
+    {
+        std::array<unsigned char, N> bytes_{};
+        uint32_t size_ = 0;
+        bool truncated_ = false;
+
+        void put(unsigned char byte)
+        {
+            if (size_ == N)
+            {
+                truncated_ = true;
+                return;
+            }
+            bytes_[size_++] = byte;
+        }
+
+        template <std::unsigned_integral TUnsigned>
+        void put_big_endian(TUnsigned value)
+        {
+            for (int shift = 8 * (sizeof(TUnsigned) - 1); shift >= 0; shift -= 8)
+                put(static_cast<unsigned char>(value >> shift));
+        }
+
+        template <typename T>
+        void append(const T& member)
+        {
+            if (truncated_)
+                return;
+
+            if constexpr (RadixSort::RadixKey<T>)
+                put_big_endian(RadixSort::Detail::to_unsigned_key(member));
+            else if constexpr (std::floating_point<T>)
+                put_big_endian(FloatOrder::total_order_key(member));
+            else if constexpr (IsPartialOrder<T>::value)
+            {
+                assert(!std::isnan(member.value));
+                append(member.value == 0 ? decltype(member.value){0} : member.value); // -0.0 == +0.0
+            }
+            else
+            {
+                for (const char c : std::string_view{member})
+                {
+                    put(static_cast<unsigned char>(c));
+                    if (c == '\0')
+                        put(0xFF);
+                }
+                put(0x00);
+                put(0x00);
+            }
+        }
+
+    public:
+        static constexpr size_t capacity = N;
+
+        NormalizedKey() = default;
+
+        template <KeyMember... TMembers>
+        explicit NormalizedKey(const TMembers&... members)
+        {
+            (append(members), ...);
+        }
+
+        bool is_truncated() const
+        {
+            return truncated_;
+        }
+
+        std::span<const unsigned char, N> bytes() const
+        {
+            return bytes_;
+        }
+
+        friend bool operator==(const NormalizedKey& a, const NormalizedKey& b)
+        {
+            return std::memcmp(a.bytes_.data(), b.bytes_.data(), N) == 0;
+        }
+
+        friend std::strong_ordering operator<=>(const NormalizedKey& a, const NormalizedKey& b)
+        {
+            return std::memcmp(a.bytes_.data(), b.bytes_.data(), N) <=> 0;
+        }
+    };
+
+    template <typename T>
+    struct IsNormalizedKey : std::false_type
+    {
+    };
+
+    template <size_t N>
+    struct IsNormalizedKey<NormalizedKey<N>> : std::true_type
+    {
+    };
+
+    template <typename TKeyOf, typename T>
+    concept KeyProjection = std::invocable<const TKeyOf&, const T&> && IsNormalizedKey<std::invoke_result_t<const TKeyOf&, const T&>>::value;
+
+    namespace Detail
+    {
+        // keys decide unless they are equal & truncated
+        template <typename T, typename TKey>
+        std::strong_ordering compare(const TKey& key_a, const T& a, const TKey& key_b, const T& b)
+        {
+            if (const auto cmp = key_a <=> key_b; cmp != 0)
+                return cmp;
+            if (key_a.is_truncated() || key_b.is_truncated())
+                return std::compare_strong_order_fallback(a, b);
+            return std::strong_ordering::equal;
+        }
+    } // namespace Detail
+
+    // sorts items in the order of <=>, returns keys of sorted items (for lower_bound_by_normalized_key)
+    template <typename T, KeyProjection<T> TKeyOf>
+    auto sort_by_normalized_key(std::vector<T>& items, const TKeyOf& key_of)
+    {
+        using TKey = std::invoke_result_t<const TKeyOf&, const T&>;
+
+        struct Entry
+        {
+            TKey key;
+            size_t index;
+        };
+
+        std::vector<Entry> entries;
+        entries.reserve(items.size());
+        for (size_t i = 0; i < items.size(); ++i)
+            entries.push_back(Entry{key_of(items[i]), i});
+
+        std::ranges::sort(entries, [&](const Entry& a, const Entry& b) { return Detail::compare(a.key, items[a.index], b.key, items[b.index]) < 0; });
+
+        std::vector<T> sorted_items;
+        std::vector<TKey> keys;
+        sorted_items.reserve(items.size());
+        keys.reserve(items.size());
+        for (Entry& entry : entries)
+        {
+            sorted_items.push_back(std::move(items[entry.index]));
+            keys.push_back(entry.key);
+        }
+        items = std::move(sorted_items);
+
+        return keys;
+    }
+
+    // index of the first item not less than value - sorted_items & keys as produced by sort_by_normalized_key
+    template <typename T, KeyProjection<T> TKeyOf>
+    size_t lower_bound_by_normalized_key(std::span<const T> sorted_items, std::span<const std::invoke_result_t<const TKeyOf&, const T&>> keys,
+        const T& value, const TKeyOf& key_of)
+    {
+        const auto key = key_of(value);
+
+        size_t first = 0;
+        size_t count = keys.size();
+        while (count > 0)
+        {
+            const size_t half = count / 2;
+            const size_t middle = first + half;
+            if (Detail::compare(keys[middle], sorted_items[middle], key, value) < 0)
+            {
+                first = middle + 1;
+                count -= half + 1;
+            }
+            else
+                count = half;
+        }
+
+        return first;
+    }
+} // namespace NormalizedKeys
+
+#endif
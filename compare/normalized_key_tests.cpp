@@ -0,0 +1,283 @@
+#include "normalized_key.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <compare>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+using NormalizedKeys::NormalizedKey;
+
+namespace
+{
+    struct Person
+    {
+        std::string name;
+        int age;
+        std::string nick;
+
+        auto operator<=>(const Person&) const = default;
+    };
+
+    struct Gadget
+    {
+        std::string name;
+        double price;
+
+        bool operator==(const Gadget& other) const = default;
+
+        std::strong_ordering operator<=>(const Gadget& other) const
+        {
+            if (std::strong_ordering cmp_result = name <=> other.name; cmp_result != 0)
+                return cmp_result;
+
+            return std::strong_order(price, other.price);
+        }
+    };
+
+    struct Reading
+    {
+        std::string sensor;
+        double value; // defaulted <=> - std::partial_ordering, -0.0 == +0.0
+
+        auto operator<=>(const Reading&) const = default;
+    };
+
+    // members listed in the order of <=>
+    auto person_key = [](const Person& p) { return NormalizedKey<24>{p.name, p.age, p.nick}; };
+    auto gadget_key = [](const Gadget& g) { return NormalizedKey<24>{g.name, g.price}; };
+    auto reading_key = [](const Reading& r) { return NormalizedKey<24>{r.sensor, NormalizedKeys::PartialOrder{r.value}}; };
+
+    template <typename T, typename TKeyOf>
+    void check_key_order(const T& a, const T& b, TKeyOf key_of)
+    {
+        const auto key_a = key_of(a);
+        const auto key_b = key_of(b);
+        if (!key_a.is_truncated() && !key_b.is_truncated())
+            CHECK((key_a <=> key_b) == (a <=> b));
+    }
+
+    std::string random_name(std::mt19937& rnd_gen)
+    {
+        // few letters with shared prefixes, embedded '\0' & bytes >= 0x80
+        static const std::string letters = "ab\0\xFFz"s;
+        std::uniform_int_distribution<size_t> length_distr(0, 30);
+        std::uniform_int_distribution<size_t> letter_distr(0, letters.size() - 1);
+
+        std::string name(length_distr(rnd_gen), 'a');
+        for (auto& c : name)
+            c = letters[letter_distr(rnd_gen)];
+        return name;
+    }
+
+    std::vector<Person> random_people(size_t count, std::mt19937& rnd_gen)
+    {
+        std::uniform_int_distribution<int> age_distr(-3, 3);
+        std::vector<Person> people(count);
+        for (auto& p : people)
+            p = Person{random_name(rnd_gen), age_distr(rnd_gen) * 1'000'000, random_name(rnd_gen)};
+        return people;
+    }
+
+    std::vector<Gadget> random_gadgets(size_t count, std::mt19937& rnd_gen)
+    {
+        const std::vector<double> prices = {-std::numeric_limits<double>::infinity(), -1.5, -0.0, 0.0, 1e-310, 2.5, 1e300,
+            std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN(), -std::numeric_limits<double>::quiet_NaN()};
+        std::uniform_int_distribution<size_t> price_distr(0, prices.size() - 1);
+        std::vector<Gadget> gadgets(count);
+        for (auto& g : gadgets)
+            g = Gadget{random_name(rnd_gen).substr(0, 3), prices[price_distr(rnd_gen)]};
+        return gadgets;
+    }
+
+    template <typename T>
+    bool is_same_order(const std::vector<T>& items, const std::vector<T>& expected)
+    {
+        return std::ranges::equal(items, expected, [](const T& a, const T& b) { return (a <=> b) == 0; });
+    }
+} // namespace
+
+TEST_CASE("normalized key - encoding preserves order of members")
+{
+    using Key = NormalizedKey<16>;
+
+    SECTION("signed & unsigned integers")
+    {
+        const std::vector<int> values = {std::numeric_limits<int>::min(), -256, -1, 0, 1, 255, 256, std::numeric_limits<int>::max()};
+        CHECK(std::ranges::is_sorted(values, {}, [](int x) { return Key{x}; }));
+        CHECK(Key{255u} < Key{256u});
+        CHECK(Key{-1LL} < Key{0LL});
+    }
+
+    SECTION("floating points - total order as std::strong_order")
+    {
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        const std::vector<double> values = {-nan, -std::numeric_limits<double>::infinity(), -1.0, -std::numeric_limits<double>::denorm_min(),
+            -0.0, 0.0, std::numeric_limits<double>::denorm_min(), 1.0, std::numeric_limits<double>::infinity(), nan};
+
+        for (double a : values)
+            for (double b : values)
+                CHECK((Key{a} <=> Key{b}) == std::strong_order(a, b));
+
+        CHECK(Key{-1.0f} < Key{1.0f});
+    }
+
+    SECTION("strings - prefix sorts first, embedded zeros are escaped")
+    {
+        CHECK(Key{""s} < Key{"a"s});
+        CHECK(Key{"ab"s} < Key{"abc"s});
+        CHECK(Key{"a"s} < Key{"a\0"s});
+        CHECK(Key{"a\0"s} < Key{"a\1"s});
+        CHECK(Key{"a\x7F"s} < Key{"a\x80"s}); // unsigned bytes - as std::string::compare
+        CHECK(Key{"abc"sv} == Key{"abc"s});
+    }
+
+    SECTION("string followed by other members")
+    {
+        CHECK(Key{"ab"s, 9} < Key{"abc"s, 0});
+        CHECK(Key{"ab"s, 0} < Key{"ab"s, 9});
+    }
+
+    SECTION("too long members are truncated")
+    {
+        const Key key{"0123456789abcdefgh"s};
+        CHECK(key.is_truncated());
+        CHECK(key == Key{"0123456789abcdefXYZ"s});
+        CHECK_FALSE(Key{"0123456789abcd"s}.is_truncated());
+    }
+}
+
+TEST_CASE("normalized key - key order matches <=>")
+{
+    std::mt19937 rnd_gen{665};
+
+    SECTION("Person")
+    {
+        const auto people = random_people(300, rnd_gen);
+        for (const auto& a : people)
+            for (const auto& b : people)
+                check_key_order(a, b, person_key);
+    }
+
+    SECTION("Gadget")
+    {
+        const auto gadgets = random_gadgets(300, rnd_gen);
+        for (const auto& a : gadgets)
+            for (const auto& b : gadgets)
+                check_key_order(a, b, gadget_key);
+    }
+}
+
+TEST_CASE("sort & lower_bound by normalized key - same results as <=>")
+{
+    std::mt19937 rnd_gen{42};
+
+    SECTION("Person - truncated keys fall back to <=>")
+    {
+        auto people = random_people(5'000, rnd_gen);
+        auto expected = people;
+        std::ranges::sort(expected, std::less<>{});
+
+        const auto keys = NormalizedKeys::sort_by_normalized_key(people, person_key);
+        REQUIRE(keys.size() == people.size());
+        CHECK(std::ranges::any_of(keys, [](const auto& key) { return key.is_truncated(); }));
+        CHECK(is_same_order(people, expected));
+
+        for (const auto& value : random_people(500, rnd_gen))
+        {
+            const auto expected_index = std::ranges::lower_bound(expected, value) - expected.begin();
+            CHECK(NormalizedKeys::lower_bound_by_normalized_key(std::span<const Person>{people}, std::span{keys}, value, person_key)
+                == static_cast<size_t>(expected_index));
+        }
+    }
+
+    SECTION("Gadget - NaN & -0.0 prices")
+    {
+        auto gadgets = random_gadgets(5'000, rnd_gen);
+        auto expected = gadgets;
+        std::ranges::sort(expected, std::less<>{});
+
+        const auto keys = NormalizedKeys::sort_by_normalized_key(gadgets, gadget_key);
+        CHECK(is_same_order(gadgets, expected));
+
+        const Gadget value{"a", -0.0};
+        const auto index = NormalizedKeys::lower_bound_by_normalized_key(std::span<const Gadget>{gadgets}, std::span{keys}, value, gadget_key);
+        CHECK(index == static_cast<size_t>(std::ranges::lower_bound(expected, value) - expected.begin()));
+    }
+
+    SECTION("Reading - defaulted <=> treats -0.0 & +0.0 as equivalent")
+    {
+        std::vector<Reading> readings = {{"t", 1.0}, {"t", -0.0}, {"t", 0.0}, {"t", -1.0}, {"t", -0.0}, {"s", 0.0}, {"t", 0.0}};
+        auto expected = readings;
+        std::ranges::sort(expected, std::less<>{});
+
+        const auto keys = NormalizedKeys::sort_by_normalized_key(readings, reading_key);
+        CHECK(std::ranges::equal(readings, expected, [](const Reading& a, const Reading& b) { return (a <=> b) == 0; }));
+
+        for (const double zero : {0.0, -0.0})
+        {
+            const Reading value{"t", zero};
+            const auto index = NormalizedKeys::lower_bound_by_normalized_key(std::span<const Reading>{readings}, std::span{keys}, value, reading_key);
+            CHECK(index == 2);
+            CHECK(index == static_cast<size_t>(std::ranges::lower_bound(expected, value) - expected.begin()));
+        }
+    }
+}
+
+TEST_CASE("normalized key - benchmark", "[.][benchmark]")
+{
+    std::mt19937 rnd_gen{665};
+    std::uniform_int_distribution<int> age_distr(0, 100);
+    std::uniform_int_distribution<int> letter_distr('a', 'd');
+
+    auto random_word = [&](size_t length) {
+        std::string word(length, 'a');
+        for (auto& c : word)
+            c = static_cast<char>(letter_distr(rnd_gen));
+        return word;
+    };
+
+    std::vector<Person> people(100'000);
+    for (auto& p : people)
+        p = Person{"Name-"s + random_word(6), age_distr(rnd_gen), random_word(8)};
+
+    BENCHMARK("sort Person - std::sort with <=>")
+    {
+        auto items = people;
+        std::ranges::sort(items, std::less<>{});
+        return items;
+    };
+
+    BENCHMARK("sort Person - sort_by_normalized_key")
+    {
+        auto items = people;
+        NormalizedKeys::sort_by_normalized_key(items, person_key);
+        return items;
+    };
+
+    auto sorted = people;
+    const auto keys = NormalizedKeys::sort_by_normalized_key(sorted, person_key);
+    std::vector<Person> lookups(people.begin(), people.begin() + 1'000);
+
+    BENCHMARK("lower_bound Person - std::lower_bound with <=>")
+    {
+        size_t sum = 0;
+        for (const auto& value : lookups)
+            sum += static_cast<size_t>(std::ranges::lower_bound(sorted, value) - sorted.begin());
+        return sum;
+    };
+
+    BENCHMARK("lower_bound Person - lower_bound_by_normalized_key")
+    {
+        size_t sum = 0;
+        for (const auto& value : lookups)
+            sum += NormalizedKeys::lower_bound_by_normalized_key(std::span<const Person>{sorted}, std::span{keys}, value, person_key);
+        return sum;
+    };
+}
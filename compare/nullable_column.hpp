@@ -0,0 +1,436 @@
+#ifndef NULLABLE_COLUMN_HPP
+#define NULLABLE_COLUMN_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////
+// Nullable column - values in a dense array + validity bitmap (as in Apache Arrow)
+//
+// Columns::NullableColumn<int> column = {2, std::nullopt, 4};
+//
+// column[0] <=> column[2];   // std::partial_ordering::less - Nullable<int> has semantics of IntNan:
+// column[0] <=> column[1];   // std::partial_ordering::unordered
+//
+// Kernels work on whole columns - 64 rows per word of the validity bitmap, no branches on nulls:
+//   compare(lhs, rhs, CompareOp::less)  -> Bitmap of rows where lhs[i] < rhs[i] (false for nulls - as IntNan)
+//   filter(column, mask)                -> NullableColumn with rows selected by mask
+//   min(column), max(column)            -> nulls skipped (or propagated) - std::nullopt for no values
+
+namespace Columns
+{
+    // integers stored in columns - bool excluded (std::vector<bool> has no contiguous storage)
+    template <typename T>
+    concept ColumnValue = std::integral<T> && !std::same_as<T, bool>;
+
+    // value of a nullable column - null is unordered with everything (as NaN)
+    template <ColumnValue T>
+    struct Nullable
+    {
+        std::optional<T> value = std::nullopt;
+
+        bool operator==(const Nullable& rhs) const
+        {
+            if (!value || !rhs.value)
+                return false;
+            return *value == *rhs.value;
+        }
+
+        std::partial_ordering operator<=>(const Nullable& rhs) const
+        {
+            if (!value || !rhs.value)
+                return std::partial_ordering::unordered;
+            return *value <=> *rhs.value;
+        }
+    };
+
+    class Bitmap
+    {
+        std::vector<uint64_t> words_;
+        size_t size_ = 0;
+
+    public:
+        static constexpr size_t bits_per_word = 64;
+
+        Bitmap() = default;
+
+        explicit Bitmap(size_t size, bool value = false)
+            : words_((size + bits_per_word - 1) / bits_per_word, value ? ~uint64_t{0} : 0)
+            , size_{size}
+        {
+            clear_padding();
+        }
+
+        size_t size() const
+        {
+            return size_;
+        }
+
+        bool test(size_t index) const
+        {
+            assert(index < size_);
+            return (words_[index / bits_per_word] >> (index % bits_per_word)) & 1;
+        }
+
+        void set(size_t index, bool value)
+        {
+            assert(index < size_);
+            const uint64_t bit = uint64_t{1} << (index % bits_per_word);
+            words_[index / bits_per_word] = value ? (words_[index / bits_per_word] | bit) : (words_[index / bits_per_word] & ~bit);
+        }
+
+        void push_back(bool value)
+        {
+            if (size_ % bits_per_word == 0)
+                words_.push_back(0);
+            words_.back() |= uint64_t{value} << (size_ % bits_per_word);
+            ++size_;
+        }
+
+        void reserve(size_t size)
+        {
+            words_.reserve((size + bits_per_word - 1) / bits_per_word);
+        }
+
+        size_t count() const
+        {
+            size_t count = 0;
+            for (uint64_t word : words_)
+                count += static_cast<size_t>(std::popcount(word));
+            return count;
+        }
+
+        // bits past size() are always zero
+        std::span<const uint64_t> words() const
+        {
+            return words_;
+        }
+
+        std::span<uint64_t> words()
+        {
+            return words_;
+        }
+
+        void clear_padding()
+        {
+            if (const size_t tail = size_ % bits_per_word; tail != 0)
+                words_.back() &= (uint64_t{1} << tail) - 1;
+        }
+
+        bool operator==(const Bitmap&) const = default;
+    };
+
+    template <ColumnValue T>
+    class NullableColumn
+    {
+        std::vector<T> values_; // null rows hold T{}
+        Bitmap validity_;
+
+    public:
+        using value_type = Nullable<T>;
+
+        NullableColumn() = default;
+
+        NullableColumn(std::initializer_list<std::optional<T>> items)
+        {
+            reserve(items.size());
+            for (const auto& item : items)
+                push_back(item);
+        }
+
+        NullableColumn(std::vector<T> values, Bitmap validity)
+            : values_(std::move(values))
+            , validity_(std::move(validity))
+        {
+            assert(values_.size() == validity_.size());
+        }
+
+        size_t size() const
+        {
+            return values_.size();
+        }
+
+        bool empty() const
+        {
+            return values_.empty();
+        }
+
+        size_t null_count() const
+        {
+            return size() - validity_.count();
+        }
+
+        void reserve(size_t size)
+        {
+            values_.reserve(size);
+            validity_.reserve(size);
+        }
+
+        void push_back(std::optional<T> item)
+        {
+            values_.push_back(item.value_or(T{}));
+            validity_.push_back(item.has_value());
+        }
+
+        bool is_valid(size_t index) const
+        {
+            return validity_.test(index);
+        }
+
+        Nullable<T> operator[](size_t index) const
+        {
+            if (!is_valid(index))
+                return Nullable<T>{};
+            return Nullable<T>{values_[index]};
+        }
+
+        std::span<const T> values() const
+        {
+            return values_;
+        }
+
+        const Bitmap& validity() const
+        {
+            return validity_;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // kernels
+
+    enum class CompareOp
+    {
+        equal,
+        not_equal,
+        less,
+        less_equal,
+        greater,
+        greater_equal
+    };
+
+    namespace Detail
+    {
+        template <CompareOp Op, typename T>
+        constexpr bool apply(T a, T b)
+        {
+            if constexpr (Op == CompareOp::equal || Op == CompareOp::not_equal)
+                return a == b;
+            else if constexpr (Op == CompareOp::less)
+                return a < b;
+            else if constexpr (Op == CompareOp::less_equal)
+                return a <= b;
+            else if constexpr (Op == CompareOp::greater)
+                return a > b;
+            else
+                return a >= b;
+        }
+
+        // result bit = op(lhs[i], rhs(i)) for valid rows - rhs is a column or a scalar
+        template <CompareOp Op, typename T, typename TRhs>
+        Bitmap compare(const NullableColumn<T>& lhs, const Bitmap* rhs_validity, TRhs rhs)
+        {
+            const size_t size = lhs.size();
+            const std::span<const T> values = lhs.values();
+
+            Bitmap result(size);
+            const auto result_words = result.words();
+            const auto lhs_words = lhs.validity().words();
+
+            for (size_t word = 0; word < result_words.size(); ++word)
+            {
+                const size_t first = word * Bitmap::bits_per_word;
+                const size_t count = std::min(Bitmap::bits_per_word, size - first);
+
+                uint64_t bits = 0;
+                for (size_t bit = 0; bit < count; ++bit)
+                    bits |= uint64_t{apply<Op>(values[first + bit], rhs(first + bit))} << bit;
+
+                uint64_t valid = lhs_words[word];
+                if (rhs_validity)
+                    valid &= rhs_validity->words()[word];
+
+                // a != b is !(a == b) - true for nulls, as for IntNan
+                result_words[word] = (Op == CompareOp::not_equal) ? ~(bits & valid) : (bits & valid);
+            }
+            result.clear_padding();
+
+            return result;
+        }
+
+        template <typename TUnsigned, size_t N>
+        constexpr std::array<TUnsigned, N> make_bit_masks()
+        {
+            std::array<TUnsigned, N> masks{};
+            for (size_t bit = 0; bit < N; ++bit)
+                masks[bit] = static_cast<TUnsigned>(TUnsigned{1} << bit);
+            return masks;
+        }
+
+        // select over 64 values - invalid ones replaced by identity with and/or masks (vectorizes, unlike shifts by bit index)
+        template <typename T, typename TSelect>
+        T reduce_masked_block(const T* values, uint64_t valid, T identity, T result, TSelect select)
+        {
+            using TUnsigned = std::make_unsigned_t<T>;
+            constexpr size_t lane_bits = std::min<size_t>(8 * sizeof(T), Bitmap::bits_per_word);
+            static constexpr auto bit_masks = make_bit_masks<TUnsigned, lane_bits>();
+
+            for (size_t chunk = 0; chunk < Bitmap::bits_per_word; chunk += lane_bits)
+            {
+                const auto chunk_valid = static_cast<TUnsigned>(valid >> chunk);
+                for (size_t bit = 0; bit < lane_bits; ++bit)
+                {
+                    const TUnsigned keep = TUnsigned{0} - TUnsigned{(chunk_valid & bit_masks[bit]) != 0};
+                    const auto value = static_cast<TUnsigned>((static_cast<TUnsigned>(values[chunk + bit]) & keep) | (static_cast<TUnsigned>(identity) & ~keep));
+                    result = select(result, static_cast<T>(value));
+                }
+            }
+
+            return result;
+        }
+
+        template <typename T, typename TSelect>
+        std::optional<T> reduce(const NullableColumn<T>& column, T identity, TSelect select)
+        {
+            const std::span<const T> values = column.values();
+            const auto valid_words = column.validity().words();
+
+            T result = identity;
+            bool any_valid = false;
+            for (size_t word = 0; word < valid_words.size(); ++word)
+            {
+                const size_t first = word * Bitmap::bits_per_word;
+                const size_t count = std::min(Bitmap::bits_per_word, values.size() - first);
+                const uint64_t valid = valid_words[word];
+
+                if (valid == 0)
+                    continue;
+                any_valid = true;
+
+                if (count == Bitmap::bits_per_word && valid == ~uint64_t{0})
+                {
+                    for (size_t bit = 0; bit < Bitmap::bits_per_word; ++bit)
+                        result = select(result, values[first + bit]);
+                }
+                else if (count == Bitmap::bits_per_word)
+                    result = reduce_masked_block(values.data() + first, valid, identity, result, select);
+                else
+                {
+                    for (size_t bit = 0; bit < count; ++bit)
+                        result = select(result, ((valid >> bit) & 1) ? values[first + bit] : identity);
+                }
+            }
+
+            if (!any_valid)
+                return std::nullopt;
+            return result;
+        }
+    } // namespace Detail
+
+    template <ColumnValue T>
+    Bitmap compare(const NullableColumn<T>& lhs, const NullableColumn<T>& rhs, CompareOp op)
+    {
+        assert(lhs.size() == rhs.size());
+
+        const auto rhs_values = rhs.values();
+        const auto rhs_at = [rhs_values](size_t index) { return rhs_values[index]; };
+
+        switch (op)
+        {
+        case CompareOp::equal:
+            return Detail::compare<CompareOp::equal>(lhs, &rhs.validity(), rhs_at);
+        case CompareOp::not_equal:
+            return Detail::compare<CompareOp::not_equal>(lhs, &rhs.validity(), rhs_at);
+        case CompareOp::less:
+            return Detail::compare<CompareOp::less>(lhs, &rhs.validity(), rhs_at);
+        case CompareOp::less_equal:
+            return Detail::compare<CompareOp::less_equal>(lhs, &rhs.validity(), rhs_at);
+        case CompareOp::greater:
+            return Detail::compare<CompareOp::greater>(lhs, &rhs.validity(), rhs_at);
+        case CompareOp::greater_equal:
+            return Detail::compare<CompareOp::greater_equal>(lhs, &rhs.validity(), rhs_at);
+        }
+        return Bitmap(lhs.size());
+    }
+
+    // compares with a (non null) scalar
+    template <ColumnValue T>
+    Bitmap compare(const NullableColumn<T>& lhs, T rhs, CompareOp op)
+    {
+        const auto rhs_at = [rhs](size_t) { return rhs; };
+
+        switch (op)
+        {
+        case CompareOp::equal:
+            return Detail::compare<CompareOp::equal>(lhs, nullptr, rhs_at);
+        case CompareOp::not_equal:
+            return Detail::compare<CompareOp::not_equal>(lhs, nullptr, rhs_at);
+        case CompareOp::less:
+            return Detail::compare<CompareOp::less>(lhs, nullptr, rhs_at);
+        case CompareOp::less_equal:
+            return Detail::compare<CompareOp::less_equal>(lhs, nullptr, rhs_at);
+        case CompareOp::greater:
+            return Detail::compare<CompareOp::greater>(lhs, nullptr, rhs_at);
+        case CompareOp::greater_equal:
+            return Detail::compare<CompareOp::greater_equal>(lhs, nullptr, rhs_at);
+        }
+        return Bitmap(lhs.size());
+    }
+
+    template <ColumnValue T>
+    NullableColumn<T> filter(const NullableColumn<T>& column, const Bitmap& mask)
+    {
+        assert(column.size() == mask.size());
+
+        const auto values = column.values();
+        const auto mask_words = mask.words();
+
+        NullableColumn<T> result;
+        result.reserve(mask.count());
+        for (size_t word = 0; word < mask_words.size(); ++word)
+        {
+            for (uint64_t bits = mask_words[word]; bits != 0; bits &= bits - 1)
+            {
+                const size_t index = word * Bitmap::bits_per_word + static_cast<size_t>(std::countr_zero(bits));
+                result.push_back(column.is_valid(index) ? std::optional<T>{values[index]} : std::nullopt);
+            }
+        }
+
+        return result;
+    }
+
+    enum class Nulls
+    {
+        skip,     // as in SQL & Arrow - min of valid values
+        propagate // as for NaN - null if any value is null
+    };
+
+    template <ColumnValue T>
+    std::optional<T> min(const NullableColumn<T>& column, Nulls nulls = Nulls::skip)
+    {
+        if (nulls == Nulls::propagate && column.null_count() != 0)
+            return std::nullopt;
+        return Detail::reduce(column, std::numeric_limits<T>::max(), [](T a, T b) { return std::min(a, b); });
+    }
+
+    template <ColumnValue T>
+    std::optional<T> max(const NullableColumn<T>& column, Nulls nulls = Nulls::skip)
+    {
+        if (nulls == Nulls::propagate && column.null_count() != 0)
+            return std::nullopt;
+        return Detail::reduce(column, std::numeric_limits<T>::lowest(), [](T a, T b) { return std::max(a, b); });
+    }
+} // namespace Columns
+
+#endif
@@ -0,0 +1,267 @@
+#include "nullable_column.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <compare>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <random>
+#include <vector>
+
+using namespace std::literals;
+
+using Columns::CompareOp;
+
+namespace
+{
+    // as in comparisons.cpp
+    struct IntNan
+    {
+        std::optional<int> value = std::nullopt;
+
+        bool operator==(const IntNan& rhs) const
+        {
+            if (!value || !rhs.value)
+                return false;
+            return *value == *rhs.value;
+        }
+
+        std::partial_ordering operator<=>(const IntNan& rhs) const
+        {
+            if (!value || !rhs.value)
+                return std::partial_ordering::unordered;
+            return *value <=> *rhs.value;
+        }
+    };
+
+    std::vector<IntNan> random_int_nans(size_t count, double null_ratio, unsigned seed)
+    {
+        std::mt19937 rnd_gen{seed};
+        std::uniform_int_distribution<int> value_distr(-100, 100);
+        std::bernoulli_distribution is_null(null_ratio);
+
+        std::vector<IntNan> items(count);
+        for (auto& item : items)
+            if (!is_null(rnd_gen))
+                item.value = value_distr(rnd_gen);
+        return items;
+    }
+
+    Columns::NullableColumn<int> to_column(const std::vector<IntNan>& items)
+    {
+        Columns::NullableColumn<int> column;
+        column.reserve(items.size());
+        for (const auto& item : items)
+            column.push_back(item.value);
+        return column;
+    }
+
+    bool apply(CompareOp op, const IntNan& a, const IntNan& b)
+    {
+        switch (op)
+        {
+        case CompareOp::equal:
+            return a == b;
+        case CompareOp::not_equal:
+            return a != b;
+        case CompareOp::less:
+            return a < b;
+        case CompareOp::less_equal:
+            return a <= b;
+        case CompareOp::greater:
+            return a > b;
+        case CompareOp::greater_equal:
+            return a >= b;
+        }
+        return false;
+    }
+
+    constexpr CompareOp all_ops[] = {CompareOp::equal, CompareOp::not_equal, CompareOp::less, CompareOp::less_equal, CompareOp::greater, CompareOp::greater_equal};
+} // namespace
+
+static_assert(!Columns::ColumnValue<bool>); // NullableColumn<bool> is rejected by the constraint
+static_assert(Columns::ColumnValue<int8_t> && Columns::ColumnValue<uint64_t>);
+
+TEST_CASE("Nullable - semantics of IntNan")
+{
+    using Columns::Nullable;
+
+    CHECK(std::is_lt(Nullable<int>{2} <=> Nullable<int>{4}));
+    CHECK((Nullable<int>{2} <=> Nullable<int>{}) == std::partial_ordering::unordered);
+
+    CHECK(Nullable<int>{2} < Nullable<int>{4});
+    CHECK_FALSE(Nullable<int>{2} < Nullable<int>{});
+    CHECK_FALSE(Nullable<int>{2} == Nullable<int>{});
+    CHECK_FALSE(Nullable<int>{} == Nullable<int>{});
+    CHECK_FALSE(Nullable<int>{2} <= Nullable<int>{});
+}
+
+TEST_CASE("NullableColumn")
+{
+    Columns::NullableColumn<int> column = {2, std::nullopt, 4};
+
+    SECTION("values & validity")
+    {
+        CHECK(column.size() == 3);
+        CHECK(column.null_count() == 1);
+        CHECK(column.is_valid(0));
+        CHECK_FALSE(column.is_valid(1));
+        CHECK(column.values()[1] == 0);
+        CHECK(column[2].value == 4);
+    }
+
+    SECTION("elements are compared as IntNan")
+    {
+        CHECK(column[0] < column[2]);
+        CHECK((column[0] <=> column[1]) == std::partial_ordering::unordered);
+        CHECK_FALSE(column[1] == column[1]);
+    }
+
+    SECTION("column is smaller than vector<optional<int>>")
+    {
+        Columns::NullableColumn<int> big_column;
+        for (int i = 0; i < 1'024; ++i)
+            big_column.push_back(i);
+        CHECK(big_column.values().size_bytes() + big_column.validity().words().size_bytes() < 1'024 * sizeof(IntNan));
+    }
+}
+
+TEST_CASE("NullableColumn - kernels")
+{
+    for (size_t size : {0u, 1u, 63u, 64u, 65u, 1'000u})
+    {
+        const auto lhs = random_int_nans(size, 0.2, 1);
+        const auto rhs = random_int_nans(size, 0.3, 2);
+        const auto lhs_column = to_column(lhs);
+        const auto rhs_column = to_column(rhs);
+
+        DYNAMIC_SECTION("compare columns - same results as IntNan - size " << size)
+        {
+            for (CompareOp op : all_ops)
+            {
+                const auto mask = Columns::compare(lhs_column, rhs_column, op);
+                REQUIRE(mask.size() == size);
+                for (size_t i = 0; i < size; ++i)
+                    CHECK(mask.test(i) == apply(op, lhs[i], rhs[i]));
+                CHECK(mask == Columns::Bitmap(mask)); // padding bits are zero
+            }
+        }
+
+        DYNAMIC_SECTION("compare with scalar - size " << size)
+        {
+            for (CompareOp op : all_ops)
+            {
+                const auto mask = Columns::compare(lhs_column, 7, op);
+                for (size_t i = 0; i < size; ++i)
+                    CHECK(mask.test(i) == apply(op, lhs[i], IntNan{7}));
+            }
+        }
+
+        DYNAMIC_SECTION("filter - size " << size)
+        {
+            const auto mask = Columns::compare(lhs_column, rhs_column, CompareOp::not_equal); // selects nulls too
+            const auto filtered = Columns::filter(lhs_column, mask);
+
+            std::vector<std::optional<int>> expected;
+            for (size_t i = 0; i < size; ++i)
+                if (lhs[i] != rhs[i])
+                    expected.push_back(lhs[i].value);
+
+            REQUIRE(filtered.size() == expected.size());
+            for (size_t i = 0; i < expected.size(); ++i)
+                CHECK(filtered[i].value == expected[i]);
+        }
+
+        DYNAMIC_SECTION("min & max - size " << size)
+        {
+            std::optional<int> expected_min;
+            std::optional<int> expected_max;
+            for (const auto& item : lhs)
+                if (item.value)
+                {
+                    expected_min = std::min(expected_min.value_or(*item.value), *item.value);
+                    expected_max = std::max(expected_max.value_or(*item.value), *item.value);
+                }
+
+            CHECK(Columns::min(lhs_column) == expected_min);
+            CHECK(Columns::max(lhs_column) == expected_max);
+        }
+    }
+
+    SECTION("min & max - nulls propagated")
+    {
+        const Columns::NullableColumn<int> column = {3, std::nullopt, -1};
+        CHECK(Columns::min(column) == -1);
+        CHECK(Columns::min(column, Columns::Nulls::propagate) == std::nullopt);
+        CHECK(Columns::max(Columns::NullableColumn<int>{3, 5}, Columns::Nulls::propagate) == 5);
+        CHECK(Columns::max(Columns::NullableColumn<int>{std::nullopt}) == std::nullopt);
+    }
+
+    SECTION("min & max - lanes narrower & wider than int")
+    {
+        Columns::NullableColumn<int8_t> bytes;
+        Columns::NullableColumn<int64_t> longs;
+        for (int i = 0; i < 200; ++i)
+        {
+            const bool is_null = (i % 3 == 0) || i == 150;
+            bytes.push_back(is_null ? std::nullopt : std::optional<int8_t>(static_cast<int8_t>(i - 100)));
+            longs.push_back(is_null ? std::nullopt : std::optional<int64_t>((i - 100) * 1'000'000'000LL));
+        }
+
+        CHECK(Columns::min(bytes) == -99);
+        CHECK(Columns::max(bytes) == 99);
+        CHECK(Columns::min(longs) == -99'000'000'000LL);
+        CHECK(Columns::max(longs) == 99'000'000'000LL);
+    }
+}
+
+TEST_CASE("NullableColumn - benchmark", "[.][benchmark]")
+{
+    const auto lhs = random_int_nans(1'000'000, 0.1, 1);
+    const auto rhs = random_int_nans(1'000'000, 0.1, 2);
+    const auto lhs_column = to_column(lhs);
+    const auto rhs_column = to_column(rhs);
+
+    BENCHMARK("count less - vector<IntNan>")
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < lhs.size(); ++i)
+            count += lhs[i] < rhs[i];
+        return count;
+    };
+
+    BENCHMARK("count less - NullableColumn")
+    {
+        return Columns::compare(lhs_column, rhs_column, CompareOp::less).count();
+    };
+
+    BENCHMARK("min - vector<IntNan>")
+    {
+        std::optional<int> result;
+        for (const auto& item : lhs)
+            if (item.value && (!result || *item.value < *result))
+                result = item.value;
+        return result;
+    };
+
+    BENCHMARK("min - NullableColumn")
+    {
+        return Columns::min(lhs_column);
+    };
+
+    BENCHMARK("filter less than scalar - vector<IntNan>")
+    {
+        std::vector<IntNan> result;
+        for (const auto& item : lhs)
+            if (item < IntNan{0})
+                result.push_back(item);
+        return result;
+    };
+
+    BENCHMARK("filter less than scalar - NullableColumn")
+    {
+        return Columns::filter(lhs_column, Columns::compare(lhs_column, 0, CompareOp::less));
+    };
+}
@@ -0,0 +1,294 @@
+#ifndef RADIX_SORT_HPP
+#define RADIX_SORT_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////
+// Radix sort for items ordered by a single integral or enum key
+//
+// RadixSort::radix_sort(values, &Value::value);               // stable LSD - one pass per byte of the key
+// RadixSort::parallel_radix_sort(ratings, &Rating::value);    // MSD split on the highest varying byte + LSD per bucket
+//
+// Keys are mapped to unsigned integers with the same order (sign bit of signed keys flipped),
+// passes over bytes that are the same for all items are skipped.
+// For other projections (or ranges that are not contiguous) both functions fall back to std::ranges::sort.
+
+namespace RadixSort
+{
+    template <typename T>
+    concept RadixKey = std::integral<T> || std::is_enum_v<T>;
+
+    namespace Detail
+    {
+        template <typename TKey>
+        struct UnsignedKey
+        {
+            using type = std::make_unsigned_t<TKey>;
+        };
+
+        template <>
+        struct UnsignedKey<bool>
+        {
+            using type = uint8_t;
+        };
+
+        template <typename TKey>
+            requires std::is_enum_v<TKey>
+        struct UnsignedKey<TKey> : UnsignedKey<std::underlying_type_t<TKey>>
+        {
+        };
+
+        template <typename TKey>
+        using UnsignedKey_t = typename UnsignedKey<TKey>::type;
+
+        // order preserving: min of signed type -> 0
+        template <RadixKey TKey>
+        constexpr UnsignedKey_t<TKey> to_unsigned_key(TKey key)
+        {
+            if constexpr (std::is_enum_v<TKey>)
+                return to_unsigned_key(static_cast<std::underlying_type_t<TKey>>(key));
+            else
+            {
+                using TUnsigned = UnsignedKey_t<TKey>;
+                auto bits = static_cast<TUnsigned>(key);
+                if constexpr (std::is_signed_v<TKey>)
+                    bits ^= TUnsigned{1} << (8 * sizeof(TKey) - 1);
+                return bits;
+            }
+        }
+
+        template <typename TProj, typename T>
+        using ProjectedKey_t = std::remove_cvref_t<std::invoke_result_t<TProj&, const T&>>;
+
+        template <typename TRng, typename TProj>
+        concept RadixSortable = std::ranges::contiguous_range<TRng> && std::ranges::sized_range<TRng>
+            && std::copyable<std::ranges::range_value_t<TRng>>
+            && std::invocable<TProj&, const std::ranges::range_value_t<TRng>&>
+            && RadixKey<ProjectedKey_t<TProj, std::ranges::range_value_t<TRng>>>;
+
+        constexpr size_t insertion_sort_threshold = 64;
+
+        // stable - as LSD passes
+        template <typename T, typename TProj>
+        void insertion_sort(std::span<T> items, TProj& proj)
+        {
+            for (size_t i = 1; i < items.size(); ++i)
+            {
+                T item = std::move(items[i]);
+                const auto key = to_unsigned_key(std::invoke(proj, item));
+
+                size_t j = i;
+                for (; j > 0 && key < to_unsigned_key(std::invoke(proj, items[j - 1])); --j)
+                    items[j] = std::move(items[j - 1]);
+                items[j] = std::move(item);
+            }
+        }
+
+        // sorts items by the lowest `digits_count` bytes of the key - scratch has the size of items
+        template <typename T, typename TProj>
+        void lsd_sort(std::span<T> items, std::span<T> scratch, TProj& proj, size_t digits_count)
+        {
+            using TUnsigned = UnsignedKey_t<ProjectedKey_t<TProj, T>>;
+            constexpr size_t key_size = sizeof(TUnsigned);
+
+            if (items.size() <= insertion_sort_threshold)
+            {
+                insertion_sort(items, proj);
+                return;
+            }
+
+            // histograms of all digits in one pass
+            std::array<std::array<size_t, 256>, key_size> counts{};
+            for (const T& item : items)
+            {
+                const TUnsigned key = to_unsigned_key(std::invoke(proj, item));
+                for (size_t digit = 0; digit < key_size; ++digit)
+                    ++counts[digit][(key >> (8 * digit)) & 0xFF];
+            }
+
+            T* source = items.data();
+            T* target = scratch.data();
+            for (size_t digit = 0; digit < std::min(digits_count, key_size); ++digit)
+            {
+                auto& digit_counts = counts[digit];
+                if (std::ranges::find(digit_counts, items.size()) != digit_counts.end())
+                    continue; // all items have the same digit
+
+                std::array<size_t, 256> offsets;
+                size_t offset = 0;
+                for (size_t bucket = 0; bucket < 256; ++bucket)
+                {
+                    offsets[bucket] = offset;
+                    offset += digit_counts[bucket];
+                }
+
+                for (size_t i = 0; i < items.size(); ++i)
+                {
+                    const TUnsigned key = to_unsigned_key(std::invoke(proj, source[i]));
+                    target[offsets[(key >> (8 * digit)) & 0xFF]++] = std::move(source[i]);
+                }
+
+                std::swap(source, target);
+            }
+
+            if (source != items.data())
+                std::move(source, source + items.size(), items.data());
+        }
+    } // namespace Detail
+
+    template <std::ranges::random_access_range TRng, typename TProj = std::identity>
+    void radix_sort(TRng&& rng, TProj proj = {})
+    {
+        if constexpr (Detail::RadixSortable<TRng, TProj>)
+        {
+            using T = std::ranges::range_value_t<TRng>;
+            using TUnsigned = Detail::UnsignedKey_t<Detail::ProjectedKey_t<TProj, T>>;
+
+            const std::span<T> items{std::ranges::data(rng), std::ranges::size(rng)};
+            if (items.size() <= Detail::insertion_sort_threshold)
+            {
+                Detail::insertion_sort(items, proj);
+                return;
+            }
+
+            std::vector<T> scratch(items.begin(), items.end());
+            Detail::lsd_sort(items, std::span<T>{scratch}, proj, sizeof(TUnsigned));
+        }
+        else
+            std::ranges::sort(rng, std::ranges::less{}, proj);
+    }
+
+    inline constexpr size_t parallel_threshold = 1 << 16;
+
+    template <std::ranges::random_access_range TRng, typename TProj = std::identity>
+    void parallel_radix_sort(TRng&& rng, TProj proj = {}, unsigned threads_count = std::max(1u, std::thread::hardware_concurrency()))
+    {
+        if constexpr (Detail::RadixSortable<TRng, TProj>)
+        {
+            using T = std::ranges::range_value_t<TRng>;
+            using TUnsigned = Detail::UnsignedKey_t<Detail::ProjectedKey_t<TProj, T>>;
+
+            const std::span<T> items{std::ranges::data(rng), std::ranges::size(rng)};
+            const size_t size = items.size();
+            const size_t chunks_count = std::min<size_t>(threads_count, size / (parallel_threshold / 4));
+            if (size < parallel_threshold || chunks_count < 2)
+            {
+                radix_sort(items, proj);
+                return;
+            }
+
+            const auto chunk = [&](size_t index) {
+                const size_t first = size * index / chunks_count;
+                const size_t last = size * (index + 1) / chunks_count;
+                return items.subspan(first, last - first);
+            };
+            const TUnsigned first_key = Detail::to_unsigned_key(std::invoke(proj, items.front()));
+
+            // phase 1: bits that vary between items - MSD splits on the highest varying byte
+            std::vector<TUnsigned> varying_bits(chunks_count);
+            {
+                std::vector<std::jthread> threads;
+                for (size_t index = 0; index < chunks_count; ++index)
+                {
+                    threads.emplace_back([&, index] {
+                        TUnsigned bits = 0;
+                        for (const T& item : chunk(index))
+                            bits |= Detail::to_unsigned_key(std::invoke(proj, item)) ^ first_key;
+                        varying_bits[index] = bits;
+                    });
+                }
+            }
+
+            const TUnsigned all_varying_bits = std::accumulate(varying_bits.begin(), varying_bits.end(), TUnsigned{0}, std::bit_or<>{});
+            if (all_varying_bits == 0)
+                return; // all keys are equal
+
+            const size_t msd_digit = (std::bit_width(all_varying_bits) - 1) / 8;
+            const auto bucket_of = [&](const T& item) { return (Detail::to_unsigned_key(std::invoke(proj, item)) >> (8 * msd_digit)) & 0xFF; };
+
+            // phase 2: histograms of chunks
+            std::vector<std::array<size_t, 256>> counts(chunks_count);
+            {
+                std::vector<std::jthread> threads;
+                for (size_t index = 0; index < chunks_count; ++index)
+                {
+                    threads.emplace_back([&, index] {
+                        auto& chunk_counts = counts[index];
+                        chunk_counts.fill(0);
+                        for (const T& item : chunk(index))
+                            ++chunk_counts[bucket_of(item)];
+                    });
+                }
+            }
+
+            // bucket bounds & offsets of chunks within buckets (keeps the sort stable)
+            std::array<size_t, 257> bucket_bounds{};
+            std::vector<std::array<size_t, 256>> offsets(chunks_count);
+            size_t offset = 0;
+            for (size_t bucket = 0; bucket < 256; ++bucket)
+            {
+                bucket_bounds[bucket] = offset;
+                for (size_t index = 0; index < chunks_count; ++index)
+                {
+                    offsets[index][bucket] = offset;
+                    offset += counts[index][bucket];
+                }
+            }
+            bucket_bounds[256] = offset;
+
+            // phase 3: scatter to buckets
+            std::vector<T> scratch(items.begin(), items.end());
+            {
+                std::vector<std::jthread> threads;
+                for (size_t index = 0; index < chunks_count; ++index)
+                {
+                    threads.emplace_back([&, index] {
+                        auto& chunk_offsets = offsets[index];
+                        for (T& item : chunk(index))
+                            scratch[chunk_offsets[bucket_of(item)]++] = std::move(item);
+                    });
+                }
+            }
+
+            // phase 4: buckets sorted by lower bytes & moved back - taken by threads one by one
+            std::atomic<size_t> next_bucket{0};
+            {
+                std::vector<std::jthread> threads;
+                for (size_t index = 0; index < chunks_count; ++index)
+                {
+                    threads.emplace_back([&] {
+                        for (size_t bucket = next_bucket++; bucket < 256; bucket = next_bucket++)
+                        {
+                            const size_t first = bucket_bounds[bucket];
+                            const size_t count = bucket_bounds[bucket + 1] - first;
+                            if (count == 0)
+                                continue;
+
+                            const std::span<T> sorted_bucket{scratch.data() + first, count};
+                            Detail::lsd_sort(sorted_bucket, items.subspan(first, count), proj, msd_digit);
+                            std::ranges::move(sorted_bucket, items.begin() + first);
+                        }
+                    });
+                }
+            }
+        }
+        else
+            std::ranges::sort(rng, std::ranges::less{}, proj);
+    }
+} // namespace RadixSort
+
+#endif
@@ -0,0 +1,255 @@
+#include "radix_sort.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <compare>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    struct Value
+    {
+        int value;
+
+        auto operator<=>(const Value& other) const = default;
+    };
+
+    enum class RatingValue : uint8_t
+    {
+        very_poor = 1,
+        poor,
+        satisfactory,
+        good,
+        very_good,
+        excellent
+    };
+
+    struct RatingStar
+    {
+        RatingValue value;
+
+        explicit RatingStar(RatingValue rating_value)
+            : value{rating_value}
+        {
+        }
+
+        auto operator<=>(const RatingStar&) const = default;
+    };
+
+    struct Rating
+    {
+        int value;
+
+        bool operator==(const Rating& other) const
+        {
+            return value == other.value;
+        }
+
+        bool operator<(const Rating& other) const
+        {
+            return value < other.value;
+        }
+    };
+
+    // key & position in input - checks stability
+    struct Item
+    {
+        int64_t key;
+        size_t position;
+    };
+
+    std::vector<Item> random_items(size_t count, int64_t min, int64_t max, unsigned seed)
+    {
+        std::mt19937_64 rnd_gen{seed};
+        std::uniform_int_distribution<int64_t> distr(min, max);
+
+        std::vector<Item> items(count);
+        for (size_t i = 0; i < count; ++i)
+            items[i] = Item{distr(rnd_gen), i};
+        return items;
+    }
+
+    template <typename TProj>
+    std::vector<Item> stable_sorted(std::vector<Item> items, TProj proj)
+    {
+        std::ranges::stable_sort(items, std::ranges::less{}, proj);
+        return items;
+    }
+
+    bool is_same(const std::vector<Item>& items, const std::vector<Item>& expected)
+    {
+        return std::ranges::equal(items, expected, [](const Item& a, const Item& b) { return a.key == b.key && a.position == b.position; });
+    }
+} // namespace
+
+TEST_CASE("radix_sort - integral keys")
+{
+    const auto key_as = []<typename TKey>(TKey) { return [](const Item& item) { return static_cast<TKey>(item.key); }; };
+
+    SECTION("int - negative & positive")
+    {
+        auto data = std::vector{42, 1, -7, 665, 0, 42, std::numeric_limits<int>::min(), std::numeric_limits<int>::max()};
+        auto expected = data;
+        std::ranges::sort(expected);
+
+        RadixSort::radix_sort(data);
+        CHECK(data == expected);
+    }
+
+    for (size_t size : {0u, 1u, 50u, 1'000u, 100'000u})
+    {
+        DYNAMIC_SECTION("stable for all key types - size " << size)
+        {
+            const auto items = random_items(size, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max(), 665);
+
+            auto check_for_key = [&](auto key_of) {
+                auto sorted = items;
+                RadixSort::radix_sort(sorted, key_of);
+                CHECK(is_same(sorted, stable_sorted(items, key_of)));
+            };
+
+            check_for_key(&Item::key);
+            check_for_key(key_as(int8_t{}));
+            check_for_key(key_as(uint16_t{}));
+            check_for_key(key_as(int32_t{}));
+            check_for_key(key_as(uint64_t{}));
+            check_for_key(key_as(char{}));
+            check_for_key([](const Item& item) { return item.key % 2 == 0; });
+            check_for_key([](const Item& item) { return static_cast<RatingValue>(item.key % 6 + 1); });
+        }
+    }
+
+    SECTION("keys with few distinct bytes")
+    {
+        auto items = random_items(10'000, -300, 300, 42);
+        const auto expected = stable_sorted(items, &Item::key);
+
+        RadixSort::radix_sort(items, &Item::key);
+        CHECK(is_same(items, expected));
+    }
+}
+
+TEST_CASE("radix_sort - falls back to std::ranges::sort")
+{
+    SECTION("projection to non-integral key")
+    {
+        std::vector<std::string> words = {"one", "two", "three", "four"};
+        RadixSort::radix_sort(words);
+        CHECK(words == std::vector{"four"s, "one"s, "three"s, "two"s});
+
+        RadixSort::radix_sort(words, &std::string::size);
+        CHECK(std::ranges::is_sorted(words, {}, &std::string::size));
+    }
+
+    SECTION("not contiguous range")
+    {
+        std::deque<int> data = {3, -1, 2};
+        RadixSort::radix_sort(data);
+        CHECK(data == std::deque{-1, 2, 3});
+    }
+}
+
+TEST_CASE("parallel_radix_sort")
+{
+    for (unsigned threads_count : {1u, 2u, 3u, 8u})
+    {
+        DYNAMIC_SECTION("threads: " << threads_count)
+        {
+            SECTION("full range of keys")
+            {
+                auto items = random_items(300'000, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max(), threads_count);
+                const auto expected = stable_sorted(items, &Item::key);
+
+                RadixSort::parallel_radix_sort(items, &Item::key, threads_count);
+                CHECK(is_same(items, expected));
+            }
+
+            SECTION("small keys - split on the lowest byte")
+            {
+                auto items = random_items(300'000, 0, 200, threads_count);
+                const auto expected = stable_sorted(items, &Item::key);
+
+                RadixSort::parallel_radix_sort(items, &Item::key, threads_count);
+                CHECK(is_same(items, expected));
+            }
+
+            SECTION("equal keys")
+            {
+                auto items = random_items(300'000, -5, -5, threads_count);
+                const auto expected = items;
+
+                RadixSort::parallel_radix_sort(items, &Item::key, threads_count);
+                CHECK(is_same(items, expected));
+            }
+        }
+    }
+
+    SECTION("existing types")
+    {
+        std::vector<RatingStar> stars;
+        for (int i = 0; i < 100'000; ++i)
+            stars.emplace_back(static_cast<RatingValue>(6 - i % 6));
+
+        RadixSort::parallel_radix_sort(stars, &RatingStar::value, 4);
+        CHECK(std::ranges::is_sorted(stars));
+    }
+}
+
+namespace
+{
+    template <typename T, typename TProj>
+    void benchmark_sorts(const std::string& name, const std::vector<T>& data, TProj proj)
+    {
+        BENCHMARK("std::sort - " + name)
+        {
+            auto items = data;
+            std::sort(items.begin(), items.end());
+            return items;
+        };
+
+        BENCHMARK("radix_sort - " + name)
+        {
+            auto items = data;
+            RadixSort::radix_sort(items, proj);
+            return items;
+        };
+
+        BENCHMARK("parallel_radix_sort - " + name)
+        {
+            auto items = data;
+            RadixSort::parallel_radix_sort(items, proj);
+            return items;
+        };
+    }
+} // namespace
+
+TEST_CASE("radix_sort - benchmark", "[.][benchmark]")
+{
+    constexpr size_t n = 1'000'000;
+
+    std::mt19937 rnd_gen{665};
+    std::uniform_int_distribution<int> value_distr(std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+    std::uniform_int_distribution<int> rating_distr(1, 6);
+
+    std::vector<Value> values;
+    std::vector<RatingStar> stars;
+    std::vector<Rating> ratings;
+    for (size_t i = 0; i < n; ++i)
+    {
+        values.push_back(Value{value_distr(rnd_gen)});
+        stars.emplace_back(static_cast<RatingValue>(rating_distr(rnd_gen)));
+        ratings.push_back(Rating{value_distr(rnd_gen) % 1'000});
+    }
+
+    benchmark_sorts("Value", values, &Value::value);
+    benchmark_sorts("RatingStar", stars, &RatingStar::value);
+    benchmark_sorts("Rating", ratings, &Rating::value);
+}
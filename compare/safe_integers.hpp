@@ -0,0 +1,190 @@
+#ifndef SAFE_INTEGERS_HPP
+#define SAFE_INTEGERS_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////
+// Safe integer comparisons over spans - exact semantics of std::cmp_less & std::in_range
+//
+// SafeIntegers::all_in_range<int32_t>(ids);              // std::in_range<int32_t>(id) for all ids
+// SafeIntegers::count_less(ids, -1);                     // number of ids where std::cmp_less(id, -1) - 0 for unsigned ids
+// SafeIntegers::narrow_into(ids, std::span{ids32});      // std::nullopt or index of the first id out of range of target
+//
+// Values are checked in blocks without early exits (loops vectorize), only a failing block is scanned
+// value by value. Range checks are shifts & ors of bits (no 64-bit compares needed), count_less maps
+// the bound into the type of values once - the loop compares values of a single type.
+
+namespace SafeIntegers
+{
+    namespace Detail
+    {
+        constexpr size_t block_size = 256;
+
+        template <std::integral TTarget, std::integral T>
+        constexpr bool covers_range_of = std::in_range<TTarget>(std::numeric_limits<T>::lowest()) && std::in_range<TTarget>(std::numeric_limits<T>::max());
+
+        // non zero if !std::in_range<TTarget>(value) - shifts, adds & ors only (no 64-bit compares in SSE2)
+        template <std::integral TTarget, std::integral T>
+            requires(!covers_range_of<TTarget, T>)
+        constexpr auto out_of_range_bits(T value)
+        {
+            using TUnsigned = std::make_unsigned_t<T>;
+            constexpr int value_bits = std::numeric_limits<TUnsigned>::digits;
+            constexpr int target_digits = std::numeric_limits<TTarget>::digits; // without sign bit
+
+            const auto bits = static_cast<TUnsigned>(value);
+            if constexpr (std::is_unsigned_v<T>)
+                return static_cast<TUnsigned>(bits >> target_digits); // value <= max of target
+            else if constexpr (std::is_unsigned_v<TTarget>)
+                return static_cast<TUnsigned>(bits >> std::min(target_digits, value_bits - 1)); // 0 <= value <= max of target
+            else
+                return static_cast<TUnsigned>(static_cast<TUnsigned>(bits + (TUnsigned{1} << target_digits)) >> (target_digits + 1)); // value shifted by -min of target (sum wraps in TUnsigned, not in promoted int)
+        }
+
+        // counter as wide as values - lanes of counters match lanes of comparisons (at least 16 bits - no overflow in a block)
+        template <std::integral T>
+        using BlockCounter_t = std::conditional_t<(sizeof(T) >= sizeof(uint16_t)), std::make_unsigned_t<T>, uint16_t>;
+
+        template <std::integral TTarget, std::integral T>
+        bool is_block_in_range(std::span<const T> block)
+        {
+            if constexpr (covers_range_of<TTarget, T>)
+                return true;
+            else
+            {
+                std::make_unsigned_t<T> out_of_range = 0;
+                for (const T value : block)
+                    out_of_range |= out_of_range_bits<TTarget>(value);
+                return out_of_range == 0;
+            }
+        }
+    } // namespace Detail
+
+    // index of the first value out of range of TTarget - values.size() if all are in range
+    template <std::integral TTarget, std::integral T>
+    size_t find_first_not_in_range(std::span<const T> values)
+    {
+        if constexpr (Detail::covers_range_of<TTarget, T>)
+            return values.size();
+
+        for (size_t first = 0; first < values.size(); first += Detail::block_size)
+        {
+            const auto block = values.subspan(first, std::min(Detail::block_size, values.size() - first));
+            if (!Detail::is_block_in_range<TTarget>(block))
+            {
+                const auto failed = std::ranges::find_if(block, [](T value) { return !std::in_range<TTarget>(value); });
+                assert(failed != block.end()); // bit check & std::in_range must agree
+                return first + static_cast<size_t>(failed - block.begin());
+            }
+        }
+
+        return values.size();
+    }
+
+    template <std::integral TTarget, std::integral T>
+    bool all_in_range(std::span<const T> values)
+    {
+        return find_first_not_in_range<TTarget>(values) == values.size();
+    }
+
+    // number of values where std::cmp_less(value, bound)
+    template <std::integral T, std::integral TBound>
+    size_t count_less(std::span<const T> values, TBound bound)
+    {
+        if (std::cmp_greater(bound, std::numeric_limits<T>::max()))
+            return values.size();
+        if (std::cmp_less_equal(bound, std::numeric_limits<T>::lowest()))
+            return 0;
+
+        const auto bound_as_value = static_cast<T>(bound); // in range of T - checked above
+
+        size_t count = 0;
+        if constexpr (sizeof(T) < sizeof(uint64_t))
+        {
+            for (size_t first = 0; first < values.size(); first += Detail::block_size)
+            {
+                const auto block = values.subspan(first, std::min(Detail::block_size, values.size() - first));
+
+                Detail::BlockCounter_t<T> block_count = 0;
+                for (const T value : block)
+                    block_count += value < bound_as_value;
+                count += block_count;
+            }
+        }
+        else
+        {
+            // no 64-bit compares in SSE2 - scalar loop is faster than emulated vector compares
+            for (const T value : values)
+                count += value < bound_as_value;
+        }
+        return count;
+    }
+
+    // target[i] = values[i] while in range of TTarget - returns std::nullopt or the index of the first value out of range
+    template <std::integral T, std::integral TTarget>
+    std::optional<size_t> narrow_into(std::span<const T> values, std::span<TTarget> target)
+    {
+        assert(values.size() == target.size());
+
+        for (size_t first = 0; first < values.size(); first += Detail::block_size)
+        {
+            const auto block = values.subspan(first, std::min(Detail::block_size, values.size() - first));
+            if (!Detail::is_block_in_range<TTarget>(block))
+            {
+                const auto failed = std::ranges::find_if(block, [](T value) { return !std::in_range<TTarget>(value); });
+                assert(failed != block.end()); // bit check & std::in_range must agree
+                const size_t failed_index = first + static_cast<size_t>(failed - block.begin());
+                for (size_t i = first; i < failed_index; ++i)
+                    target[i] = static_cast<TTarget>(values[i]);
+                return failed_index;
+            }
+
+            // block is still in cache
+            for (size_t i = 0; i < block.size(); ++i)
+                target[first + i] = static_cast<TTarget>(block[i]);
+        }
+
+        return std::nullopt;
+    }
+
+    class NarrowingError : public std::out_of_range
+    {
+        size_t index_;
+
+    public:
+        explicit NarrowingError(size_t index)
+            : std::out_of_range{"value at index " + std::to_string(index) + " is out of range of target type"}
+            , index_{index}
+        {
+        }
+
+        size_t index() const
+        {
+            return index_;
+        }
+    };
+
+    // throws NarrowingError with the index of the first value out of range
+    template <std::integral TTarget, std::integral T>
+    std::vector<TTarget> narrow(std::span<const T> values)
+    {
+        std::vector<TTarget> result(values.size());
+        if (const auto failed_index = narrow_into(values, std::span{result}))
+            throw NarrowingError{*failed_index};
+        return result;
+    }
+} // namespace SafeIntegers
+
+#endif
@@ -0,0 +1,253 @@
+#include "safe_integers.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    // extremes of all integer types & random values between
+    template <typename T>
+    std::vector<T> test_values(size_t count, unsigned seed)
+    {
+        const std::vector<long double> extremes = {0, 1, -1, 127, 128, -128, -129, 255, 256, 32'767, 32'768, -32'769, 65'535, 65'536,
+            2'147'483'647.0L, 2'147'483'648.0L, -2'147'483'649.0L, 4'294'967'295.0L, 4'294'967'296.0L, 9'223'372'036'854'775'807.0L,
+            -9'223'372'036'854'775'808.0L};
+
+        std::vector<T> values;
+        for (long double extreme : extremes)
+            if (extreme >= static_cast<long double>(std::numeric_limits<T>::lowest()) && extreme <= static_cast<long double>(std::numeric_limits<T>::max()))
+                values.push_back(static_cast<T>(extreme));
+        values.push_back(std::numeric_limits<T>::lowest());
+        values.push_back(std::numeric_limits<T>::max());
+
+        std::mt19937_64 rnd_gen{seed};
+        std::uniform_int_distribution<int> shift_distr(0, 8 * sizeof(T) - 1);
+        while (values.size() < count)
+        {
+            const auto bits = static_cast<T>(rnd_gen());
+            values.push_back(static_cast<T>(bits >> shift_distr(rnd_gen))); // small & big magnitudes
+        }
+
+        std::ranges::shuffle(values, rnd_gen);
+        return values;
+    }
+
+    template <typename TTarget, typename T>
+    void check_in_range_kernels(const std::vector<T>& values)
+    {
+        const std::span<const T> span{values};
+
+        const auto expected_first = std::ranges::find_if(values, [](T value) { return !std::in_range<TTarget>(value); }) - values.begin();
+        CHECK(SafeIntegers::find_first_not_in_range<TTarget>(span) == static_cast<size_t>(expected_first));
+        CHECK(SafeIntegers::all_in_range<TTarget>(span) == std::ranges::all_of(values, [](T value) { return std::in_range<TTarget>(value); }));
+
+        std::vector<TTarget> target(values.size());
+        const auto failed_index = SafeIntegers::narrow_into(span, std::span{target});
+        if (static_cast<size_t>(expected_first) == values.size())
+            CHECK_FALSE(failed_index.has_value());
+        else
+            CHECK(failed_index == static_cast<size_t>(expected_first));
+
+        for (size_t i = 0; i < static_cast<size_t>(expected_first); ++i)
+            CHECK(std::cmp_equal(target[i], values[i]));
+    }
+
+    template <typename T, typename TBound>
+    void check_count_less(const std::vector<T>& values, const std::vector<TBound>& bounds)
+    {
+        for (TBound bound : bounds)
+        {
+            const auto expected = std::ranges::count_if(values, [bound](T value) { return std::cmp_less(value, bound); });
+            CHECK(SafeIntegers::count_less(std::span<const T>{values}, bound) == static_cast<size_t>(expected));
+        }
+    }
+
+    template <typename T>
+    void check_for_all_targets(const std::vector<T>& values)
+    {
+        check_in_range_kernels<int8_t>(values);
+        check_in_range_kernels<uint8_t>(values);
+        check_in_range_kernels<int16_t>(values);
+        check_in_range_kernels<uint16_t>(values);
+        check_in_range_kernels<int32_t>(values);
+        check_in_range_kernels<uint32_t>(values);
+        check_in_range_kernels<int64_t>(values);
+        check_in_range_kernels<uint64_t>(values);
+
+        check_count_less(values, test_values<int8_t>(30, 1));
+        check_count_less(values, test_values<uint16_t>(30, 2));
+        check_count_less(values, test_values<int32_t>(30, 3));
+        check_count_less(values, test_values<uint32_t>(30, 4));
+        check_count_less(values, test_values<int64_t>(30, 5));
+        check_count_less(values, test_values<uint64_t>(30, 6));
+    }
+} // namespace
+
+TEST_CASE("safe integer kernels - same results as std::cmp_less & std::in_range")
+{
+    SECTION("int8_t")
+    {
+        check_for_all_targets(test_values<int8_t>(1'000, 665));
+    }
+
+    SECTION("uint8_t")
+    {
+        check_for_all_targets(test_values<uint8_t>(1'000, 665));
+    }
+
+    SECTION("int16_t")
+    {
+        check_for_all_targets(test_values<int16_t>(1'000, 665));
+    }
+
+    SECTION("uint16_t")
+    {
+        check_for_all_targets(test_values<uint16_t>(1'000, 665));
+    }
+
+    SECTION("int32_t")
+    {
+        check_for_all_targets(test_values<int32_t>(1'000, 665));
+    }
+
+    SECTION("uint32_t")
+    {
+        check_for_all_targets(test_values<uint32_t>(1'000, 665));
+    }
+
+    SECTION("int64_t")
+    {
+        check_for_all_targets(test_values<int64_t>(1'000, 665));
+    }
+
+    SECTION("uint64_t")
+    {
+        check_for_all_targets(test_values<uint64_t>(1'000, 665));
+    }
+}
+
+TEST_CASE("safe integer kernels - mixed signedness")
+{
+    const std::vector<int> values = {-7, 0, 42, 665};
+    const std::span<const int> span{values};
+
+    CHECK(SafeIntegers::count_less(span, 42u) == 2); // -7 counted - built-in -7 < 42u is false
+    CHECK(SafeIntegers::count_less(span, std::numeric_limits<uint64_t>::max()) == 4);
+    CHECK(SafeIntegers::count_less(std::span<const unsigned>{std::vector{0u, 1u}}, -1) == 0);
+
+    CHECK_FALSE(SafeIntegers::all_in_range<unsigned>(span));
+    CHECK(SafeIntegers::all_in_range<int16_t>(span));
+}
+
+TEST_CASE("safe integer kernels - values narrower than int")
+{
+    // sums in bit checks are promoted to int - must wrap as the type of values
+    const std::vector<int16_t> minus_ones(300, int16_t{-1});
+    const std::span<const int16_t> span{minus_ones};
+
+    CHECK(SafeIntegers::all_in_range<int8_t>(span));
+    CHECK(SafeIntegers::find_first_not_in_range<int8_t>(span) == minus_ones.size());
+    CHECK(SafeIntegers::narrow<int8_t>(span) == std::vector<int8_t>(300, int8_t{-1}));
+}
+
+TEST_CASE("safe integer kernels - narrowing")
+{
+    std::vector<int64_t> ids(1'000);
+    for (size_t i = 0; i < ids.size(); ++i)
+        ids[i] = static_cast<int64_t>(i) * 1'000;
+
+    SECTION("all in range")
+    {
+        const auto narrowed = SafeIntegers::narrow<int32_t>(std::span<const int64_t>{ids});
+        CHECK(std::ranges::equal(narrowed, ids, [](int32_t a, int64_t b) { return std::cmp_equal(a, b); }));
+    }
+
+    SECTION("first failing index reported")
+    {
+        ids[700] = -1;
+        ids[900] = -2;
+
+        try
+        {
+            SafeIntegers::narrow<uint16_t>(std::span<const int64_t>{ids});
+            FAIL("NarrowingError expected");
+        }
+        catch (const SafeIntegers::NarrowingError& e)
+        {
+            CHECK(e.index() == 66); // 66'000 > 65'535
+        }
+
+        std::vector<uint32_t> target(ids.size());
+        CHECK(SafeIntegers::narrow_into(std::span<const int64_t>{ids}, std::span{target}) == 700u);
+        CHECK(target[699] == 699'000);
+    }
+}
+
+namespace
+{
+    // ids fit in cache - for arrays in memory the kernels are bound by bandwidth
+    template <typename T>
+    void benchmark_kernels(const std::string& type_name)
+    {
+        std::mt19937_64 rnd_gen{665};
+        std::uniform_int_distribution<T> id_distr(0, std::numeric_limits<int32_t>::max());
+
+        std::vector<T> ids(1 << 16);
+        for (auto& id : ids)
+            id = id_distr(rnd_gen);
+        const std::span<const T> span{ids};
+        std::vector<int32_t> target(ids.size());
+        const T bound = id_distr(rnd_gen);
+
+        BENCHMARK("all in range - std::in_range loop - " + type_name)
+        {
+            return std::ranges::all_of(ids, [](T id) { return std::in_range<int32_t>(id); });
+        };
+
+        BENCHMARK("all in range - all_in_range - " + type_name)
+        {
+            return SafeIntegers::all_in_range<int32_t>(span);
+        };
+
+        BENCHMARK("count less - std::cmp_less loop - " + type_name)
+        {
+            return std::ranges::count_if(ids, [bound](T id) { return std::cmp_less(id, bound); });
+        };
+
+        BENCHMARK("count less - count_less - " + type_name)
+        {
+            return SafeIntegers::count_less(span, bound);
+        };
+
+        BENCHMARK("narrowing - std::in_range loop - " + type_name)
+        {
+            for (size_t i = 0; i < ids.size(); ++i)
+            {
+                if (!std::in_range<int32_t>(ids[i]))
+                    return i;
+                target[i] = static_cast<int32_t>(ids[i]);
+            }
+            return ids.size();
+        };
+
+        BENCHMARK("narrowing - narrow_into - " + type_name)
+        {
+            return SafeIntegers::narrow_into(span, std::span{target}).value_or(ids.size());
+        };
+    }
+} // namespace
+
+TEST_CASE("safe integer kernels - benchmark", "[.][benchmark]")
+{
+    benchmark_kernels<uint32_t>("uint32_t");
+    benchmark_kernels<uint64_t>("uint64_t");
+}
@@ -0,0 +1,251 @@
+#ifndef BAKED_CONFIG_HPP
+#define BAKED_CONFIG_HPP
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/////////////////////////////////////////////////////////////////////////////////
+// Configuration baked into the binary at build time
+//
+// config file: "key = value" lines, '#' or ';' start a comment line
+//
+// CMake embeds the file as a constexpr char array (embed_file.cmake), the consteval parser
+// turns it into a table of string_views pointing into that array:
+//
+//   #include "app_config_data.hpp"
+//   constexpr auto config = CompileTime::bake_config<app_config_data>();
+//   constinit int port = config.value<int>("port");
+//
+// No file I/O, no parsing & no dynamic initialization at startup. Syntax errors, missing keys and
+// invalid values are compile errors. RuntimeConfig parses the same format from a stream.
+
+namespace CompileTime
+{
+    struct ConfigEntry
+    {
+        std::string_view key;
+        std::string_view value;
+    };
+
+    namespace Detail
+    {
+        constexpr bool is_blank(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\r';
+        }
+
+        constexpr std::string_view trim(std::string_view text)
+        {
+            while (!text.empty() && is_blank(text.front()))
+                text.remove_prefix(1);
+            while (!text.empty() && is_blank(text.back()))
+                text.remove_suffix(1);
+            return text;
+        }
+
+        // calls f(key, value) for every entry in order of appearance
+        template <typename F>
+        constexpr void for_each_config_entry(std::string_view text, F f)
+        {
+            while (!text.empty())
+            {
+                const size_t eol = text.find('\n');
+                const std::string_view line = trim(text.substr(0, eol));
+                text.remove_prefix(eol == std::string_view::npos ? text.size() : eol + 1);
+
+                if (line.empty() || line.front() == '#' || line.front() == ';')
+                    continue;
+
+                const size_t separator = line.find('=');
+                if (separator == std::string_view::npos)
+                    throw std::invalid_argument("config: line without '='");
+
+                const std::string_view key = trim(line.substr(0, separator));
+                if (key.empty())
+                    throw std::invalid_argument("config: empty key");
+
+                f(key, trim(line.substr(separator + 1)));
+            }
+        }
+
+        template <std::integral T>
+        constexpr std::optional<T> parse_integer(std::string_view text)
+        {
+            const bool negative = !text.empty() && text.front() == '-';
+            if (negative || (!text.empty() && text.front() == '+'))
+                text.remove_prefix(1);
+
+            if (text.empty())
+                return std::nullopt;
+
+            // largest magnitude: max for positive numbers, |min| for negative ones
+            const unsigned long long limit = negative ? 0ull - static_cast<unsigned long long>(std::numeric_limits<T>::min())
+                                                      : static_cast<unsigned long long>(std::numeric_limits<T>::max());
+
+            unsigned long long magnitude = 0;
+            for (const char c : text)
+            {
+                if (c < '0' || c > '9')
+                    return std::nullopt;
+
+                const auto digit = static_cast<unsigned long long>(c - '0');
+                if (digit > limit || magnitude > (limit - digit) / 10)
+                    return std::nullopt;
+                magnitude = magnitude * 10 + digit;
+            }
+
+            return static_cast<T>(negative ? 0ull - magnitude : magnitude);
+        }
+    } // namespace Detail
+
+    // conversion of a raw config value - nullopt if the text is not a valid T
+    template <typename T>
+    constexpr std::optional<T> config_value_as(std::string_view text)
+    {
+        if constexpr (std::same_as<T, std::string_view>)
+            return text;
+        else if constexpr (std::same_as<T, bool>)
+        {
+            if (text == "true" || text == "on" || text == "1")
+                return true;
+            if (text == "false" || text == "off" || text == "0")
+                return false;
+            return std::nullopt;
+        }
+        else
+        {
+            static_assert(std::integral<T>, "config values can be read as std::string_view, bool or integers");
+            return Detail::parse_integer<T>(text);
+        }
+    }
+
+    // common interface of baked & runtime configs
+    template <typename TConfig>
+    class ConfigAccess
+    {
+    public:
+        template <typename T>
+        constexpr std::optional<T> get(std::string_view key) const
+        {
+            const std::optional<std::string_view> text = static_cast<const TConfig&>(*this).find(key);
+            return text ? config_value_as<T>(*text) : std::nullopt;
+        }
+
+        template <typename T>
+        constexpr T value(std::string_view key) const
+        {
+            const std::optional<std::string_view> text = static_cast<const TConfig&>(*this).find(key);
+            if (!text)
+                throw std::out_of_range("config: missing key");
+
+            const std::optional<T> result = config_value_as<T>(*text);
+            if (!result)
+                throw std::invalid_argument("config: invalid value");
+            return *result;
+        }
+
+        template <typename T>
+        constexpr T value_or(std::string_view key, T default_value) const
+        {
+            return get<T>(key).value_or(default_value);
+        }
+    };
+
+    constexpr size_t count_config_entries(std::string_view text)
+    {
+        size_t count = 0;
+        Detail::for_each_config_entry(text, [&count](std::string_view, std::string_view) { ++count; });
+        return count;
+    }
+
+    template <size_t N>
+    class ConfigTable : public ConfigAccess<ConfigTable<N>>
+    {
+        std::array<ConfigEntry, N> entries_{};
+
+    public:
+        constexpr explicit ConfigTable(std::string_view text)
+        {
+            size_t index = 0;
+            Detail::for_each_config_entry(text, [&](std::string_view key, std::string_view value) {
+                for (size_t i = 0; i < index; ++i)
+                    if (entries_[i].key == key)
+                        throw std::invalid_argument("config: duplicated key");
+                entries_[index++] = {key, value};
+            });
+        }
+
+        // linear search - configs are small & the search is usually done at compile time
+        constexpr std::optional<std::string_view> find(std::string_view key) const
+        {
+            for (const ConfigEntry& entry : entries_)
+                if (entry.key == key)
+                    return entry.value;
+            return std::nullopt;
+        }
+
+        static constexpr size_t size()
+        {
+            return N;
+        }
+
+        constexpr auto begin() const
+        {
+            return entries_.begin();
+        }
+
+        constexpr auto end() const
+        {
+            return entries_.end();
+        }
+    };
+
+    // Text - null-terminated char array with static storage duration (generated by embed_file.cmake)
+    template <const auto& Text>
+    consteval auto bake_config()
+    {
+        constexpr std::string_view text{Text, std::size(Text) - 1};
+        return ConfigTable<count_config_entries(text)>{text};
+    }
+
+    // the same format parsed at runtime (e.g. for configs that can be changed without rebuilding)
+    class RuntimeConfig : public ConfigAccess<RuntimeConfig>
+    {
+        std::map<std::string, std::string, std::less<>> entries_;
+
+    public:
+        explicit RuntimeConfig(std::istream& in)
+        {
+            const std::string text{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+            Detail::for_each_config_entry(text, [this](std::string_view key, std::string_view value) {
+                if (!entries_.emplace(key, value).second)
+                    throw std::invalid_argument("config: duplicated key");
+            });
+        }
+
+        std::optional<std::string_view> find(std::string_view key) const
+        {
+            const auto it = entries_.find(key);
+            if (it == entries_.end())
+                return std::nullopt;
+            return it->second;
+        }
+
+        size_t size() const
+        {
+            return entries_.size();
+        }
+    };
+} // namespace CompileTime
+
+#endif
@@ -0,0 +1,115 @@
+#include "baked_config.hpp"
+
+#include "app_config_data.hpp" // generated from app.cfg by CMake
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string_view>
+
+using namespace std::literals;
+
+namespace
+{
+    struct ServerConfig
+    {
+        std::string_view name;
+        uint16_t port;
+        int threads;
+        int timeout_ms;
+        bool verbose;
+        int max_retries;
+        int log_level;
+    };
+
+    template <typename TConfig>
+    constexpr ServerConfig make_server_config(const TConfig& config)
+    {
+        return ServerConfig{
+            .name = config.template value<std::string_view>("name"),
+            .port = config.template value<uint16_t>("port"),
+            .threads = config.template value<int>("threads"),
+            .timeout_ms = config.template value<int>("timeout_ms"),
+            .verbose = config.template value<bool>("verbose"),
+            .max_retries = config.template value_or<int>("max_retries", 5),
+            .log_level = config.template value_or<int>("log_level", 0),
+        };
+    }
+
+    constexpr auto baked_config = CompileTime::bake_config<app_config_data>();
+
+    constinit ServerConfig server_config = make_server_config(baked_config); // no parsing at startup
+} // namespace
+
+TEST_CASE("bake_config - values parsed at compile time")
+{
+    static_assert(decltype(baked_config)::size() == 7);
+
+    CHECK(server_config.name == "demo-server");
+    CHECK(server_config.port == 8080);
+    CHECK(server_config.threads == 4);
+    CHECK(server_config.timeout_ms == 250);
+    CHECK(server_config.verbose);
+    CHECK(server_config.max_retries == 3);
+    CHECK(server_config.log_level == -1);
+
+    CHECK_FALSE(baked_config.get<int>("missing").has_value());
+    CHECK_FALSE(baked_config.get<int>("name").has_value());
+}
+
+TEST_CASE("bake_config - identical values to the runtime parser")
+{
+    std::ifstream config_file{APP_CONFIG_PATH};
+    REQUIRE(config_file.is_open());
+
+    const CompileTime::RuntimeConfig runtime_config{config_file};
+    REQUIRE(runtime_config.size() == baked_config.size());
+
+    for (const auto& [key, value] : baked_config)
+        CHECK(runtime_config.find(key) == value);
+
+    const ServerConfig from_runtime = make_server_config(runtime_config);
+    CHECK(from_runtime.name == server_config.name);
+    CHECK(from_runtime.port == server_config.port);
+    CHECK(from_runtime.threads == server_config.threads);
+    CHECK(from_runtime.timeout_ms == server_config.timeout_ms);
+    CHECK(from_runtime.verbose == server_config.verbose);
+    CHECK(from_runtime.max_retries == server_config.max_retries);
+    CHECK(from_runtime.log_level == server_config.log_level);
+}
+
+TEST_CASE("config parser")
+{
+    constexpr auto text = "# comment\n"
+                          "  key = value with spaces  \r\n"
+                          "\n"
+                          "; another comment\n"
+                          "empty =\n"
+                          "min = -128\n"
+                          "too_big = 256\n"
+                          "flag = off"sv;
+
+    constexpr CompileTime::ConfigTable<CompileTime::count_config_entries(text)> config{text};
+
+    static_assert(config.size() == 5);
+    static_assert(config.value<std::string_view>("key") == "value with spaces");
+    static_assert(config.value<std::string_view>("empty").empty());
+    static_assert(config.value<int8_t>("min") == -128);
+    static_assert(!config.get<uint8_t>("min").has_value());
+    static_assert(!config.get<uint8_t>("too_big").has_value());
+    static_assert(config.value<uint16_t>("too_big") == 256);
+    static_assert(!config.value<bool>("flag"));
+
+    SECTION("runtime parser reports errors by exceptions")
+    {
+        std::istringstream duplicated_key{"a = 1\na = 2\n"};
+        CHECK_THROWS_AS(CompileTime::RuntimeConfig{duplicated_key}, std::invalid_argument);
+
+        std::istringstream missing_separator{"a = 1\nb\n"};
+        CHECK_THROWS_AS(CompileTime::RuntimeConfig{missing_separator}, std::invalid_argument);
+
+        std::istringstream valid{"a = 1\n"};
+        const CompileTime::RuntimeConfig config{valid};
+        CHECK_THROWS_AS(config.value<int>("b"), std::out_of_range);
+    }
+}
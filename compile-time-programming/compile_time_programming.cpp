@@ -1,3 +1,5 @@
+#include "unique_average.hpp"
+
 #include <algorithm>
 #include <catch2/catch_test_macros.hpp>
 #include <iostream>
@@ -60,25 +62,13 @@ TEST_CASE("constexpr extensions")
 }
 
 template <std::ranges::input_range... TRng_>
+    requires std::integral<std::common_type_t<std::ranges::range_value_t<TRng_>...>> // both branches sum exactly the same values
 constexpr auto avg_for_unique(const TRng_&... rng)
 {
-    using TElement = std::common_type_t<std::ranges::range_value_t<TRng_>...>;
-
-    std::vector<TElement> vec;                            // empty vector
-    vec.reserve((... + rng.size()));                      // reserve a buffer
-    (vec.insert(vec.end(), rng.begin(), rng.end()), ...); // fold expression C++17
-
-    // sort items
-    std::ranges::sort(vec); // std::sort(vec.begin(), vec.end());
-
-    // create span of unique_items
-    auto new_end = std::unique(vec.begin(), vec.end());
-    std::span unique_items{vec.begin(), new_end};
-
-    // calculate sum of unique items
-    auto sum = std::accumulate(unique_items.begin(), unique_items.end(), TElement{});
-
-    return sum / static_cast<double>(unique_items.size());
+    if (std::is_constant_evaluated())
+        return Stats::avg_for_unique_sorted(rng...); // sort + unique - O(n log n)
+    else
+        return Stats::avg_for_unique_hashed(rng...); // flat hash set - O(n)
 }
 
 TEST_CASE("avg for unique")
@@ -89,6 +79,8 @@ TEST_CASE("avg for unique")
     constexpr auto avg = avg_for_unique(lst1, lst2);
 
     std::cout << "AVG: " << avg << "\n";
+
+    CHECK(avg_for_unique(lst1, lst2) == avg);
 }
 
 template <typename... TArgs>
@@ -0,0 +1,18 @@
+# Generates a C++ header with contents of a file as a constexpr char array (poor man's #embed)
+#
+# cmake -DINPUT=<file> -DOUTPUT=<header> -DNAME=<identifier> -P embed_file.cmake
+#
+# The array is null-terminated: std::string_view{NAME, sizeof(NAME) - 1} covers the file contents.
+
+file(READ ${INPUT} CONTENT HEX)
+string(REGEX REPLACE "([0-9a-f][0-9a-f])" "'\\\\x\\1', " BYTES "${CONTENT}")
+
+get_filename_component(INPUT_NAME ${INPUT} NAME)
+string(TOUPPER ${NAME} GUARD)
+
+file(WRITE ${OUTPUT}
+     "// generated from ${INPUT_NAME} - do not edit\n"
+     "#ifndef ${GUARD}_HPP\n"
+     "#define ${GUARD}_HPP\n\n"
+     "inline constexpr char ${NAME}[] = {${BYTES}'\\0'};\n\n"
+     "#endif\n")
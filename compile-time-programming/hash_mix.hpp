@@ -0,0 +1,26 @@
+#ifndef HASH_MIX_HPP
+#define HASH_MIX_HPP
+
+#include <cstdint>
+
+/////////////////////////////////////////////////////////////////////////////////
+// Hash mixing
+//
+// mix64(h) - murmur3 64-bit finalizer: every input bit affects every output bit.
+// std::hash of integers is an identity in libstdc++ & MSVC - tables that take positions from low bits
+// (or partitions from high bits) need the hash mixed first.
+
+namespace Hashing
+{
+    constexpr uint64_t mix64(uint64_t h)
+    {
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDull;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53ull;
+        h ^= h >> 33;
+        return h;
+    }
+} // namespace Hashing
+
+#endif
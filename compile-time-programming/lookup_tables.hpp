@@ -0,0 +1,272 @@
+#ifndef LOOKUP_TABLES_HPP
+#define LOOKUP_TABLES_HPP
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////////////////////
+// Compile-time lookup tables
+//
+// constexpr auto squares = make_lut<16>([](size_t i) { return i * i; }); // Lut<uint8_t, 16>
+//
+// make_lut is consteval - the table is always computed by the compiler. Integral tables use
+// the narrowest integer type that holds all values; tables are aligned to 64 bytes
+// (cache line / SIMD gather friendly).
+
+namespace CompileTime
+{
+    inline constexpr size_t lut_alignment = 64;
+
+    template <typename T, size_t N>
+    struct alignas(lut_alignment) Lut
+    {
+        using value_type = T;
+
+        std::array<T, N> values;
+
+        constexpr T operator[](size_t index) const
+        {
+            return values[index];
+        }
+
+        static constexpr size_t size()
+        {
+            return N;
+        }
+
+        constexpr const T* data() const
+        {
+            return values.data();
+        }
+
+        constexpr auto begin() const
+        {
+            return values.begin();
+        }
+
+        constexpr auto end() const
+        {
+            return values.end();
+        }
+    };
+
+    namespace Detail
+    {
+        template <std::intmax_t Min, std::uintmax_t Max>
+        consteval auto narrowest_type()
+        {
+            if constexpr (Min >= 0)
+            {
+                if constexpr (Max <= std::numeric_limits<uint8_t>::max())
+                    return std::type_identity<uint8_t>{};
+                else if constexpr (Max <= std::numeric_limits<uint16_t>::max())
+                    return std::type_identity<uint16_t>{};
+                else if constexpr (Max <= std::numeric_limits<uint32_t>::max())
+                    return std::type_identity<uint32_t>{};
+                else
+                    return std::type_identity<uint64_t>{};
+            }
+            else
+            {
+                if constexpr (Min >= std::numeric_limits<int8_t>::min() && Max <= std::numeric_limits<int8_t>::max())
+                    return std::type_identity<int8_t>{};
+                else if constexpr (Min >= std::numeric_limits<int16_t>::min() && Max <= std::numeric_limits<int16_t>::max())
+                    return std::type_identity<int16_t>{};
+                else if constexpr (Min >= std::numeric_limits<int32_t>::min() && Max <= std::numeric_limits<int32_t>::max())
+                    return std::type_identity<int32_t>{};
+                else
+                    return std::type_identity<int64_t>{};
+            }
+        }
+
+        template <size_t N, typename F>
+        consteval auto value_range()
+        {
+            using TResult = std::invoke_result_t<F, size_t>;
+
+            F f{};
+            std::intmax_t min_value = 0;
+            std::uintmax_t max_value = 0;
+            for (size_t i = 0; i < N; ++i)
+            {
+                const TResult value = f(i);
+                if (std::cmp_less(value, min_value))
+                    min_value = static_cast<std::intmax_t>(value);
+                if (std::cmp_greater(value, max_value))
+                    max_value = static_cast<std::uintmax_t>(value);
+            }
+            return std::pair{min_value, max_value};
+        }
+
+        template <size_t N, typename F>
+        consteval auto lut_element_type()
+        {
+            using TResult = std::invoke_result_t<F, size_t>;
+
+            if constexpr (std::integral<TResult> && !std::same_as<TResult, bool>)
+            {
+                constexpr auto range = value_range<N, F>();
+                return narrowest_type<range.first, range.second>();
+            }
+            else
+                return std::type_identity<TResult>{};
+        }
+    } // namespace Detail
+
+    // f - stateless callable: f(index) -> value
+    template <size_t N, typename F>
+        requires std::default_initializable<F> && std::invocable<F, size_t>
+    consteval auto make_lut(F)
+    {
+        using T = typename decltype(Detail::lut_element_type<N, F>())::type;
+
+        F f{};
+        Lut<T, N> lut{};
+        for (size_t i = 0; i < N; ++i)
+            lut.values[i] = static_cast<T>(f(i));
+        return lut;
+    }
+
+    ///////////////////////////
+    // constexpr math used by the built-in tables
+
+    namespace Math
+    {
+        constexpr double sin(double x)
+        {
+            constexpr double pi = std::numbers::pi;
+
+            // range reduction to [-pi, pi]
+            x -= 2 * pi * static_cast<long long>(x / (2 * pi));
+            if (x > pi)
+                x -= 2 * pi;
+            else if (x < -pi)
+                x += 2 * pi;
+
+            double term = x;
+            double result = x;
+            for (int n = 1; n < 15; ++n)
+            {
+                term *= -x * x / ((2 * n) * (2 * n + 1));
+                result += term;
+            }
+            return result;
+        }
+
+        constexpr double exp(double x)
+        {
+            // exp(x) = exp(x / 2^k)^(2^k)
+            int k = 0;
+            while (x > 0.5 || x < -0.5)
+            {
+                x /= 2;
+                ++k;
+            }
+
+            double term = 1.0;
+            double result = 1.0;
+            for (int n = 1; n < 20; ++n)
+            {
+                term *= x / n;
+                result += term;
+            }
+
+            for (; k > 0; --k)
+                result *= result;
+            return result;
+        }
+
+        constexpr double log(double x) // x > 0
+        {
+            // x = m * 2^e, m in [1, 2)
+            int e = 0;
+            while (x >= 2.0)
+            {
+                x /= 2;
+                ++e;
+            }
+            while (x < 1.0)
+            {
+                x *= 2;
+                --e;
+            }
+
+            // log(m) = 2 * atanh((m - 1) / (m + 1))
+            const double y = (x - 1) / (x + 1);
+            double term = y;
+            double result = 0.0;
+            for (int n = 1; n < 40; n += 2)
+            {
+                result += term / n;
+                term *= y * y;
+            }
+            return 2 * result + e * std::numbers::ln2;
+        }
+
+        constexpr double pow(double base, double exponent) // base >= 0
+        {
+            return base == 0.0 ? 0.0 : exp(exponent * log(base));
+        }
+
+        constexpr long long round(double x)
+        {
+            return x < 0 ? -static_cast<long long>(-x + 0.5) : static_cast<long long>(x + 0.5);
+        }
+    } // namespace Math
+
+    ///////////////////////////
+    // built-in tables
+
+    // number of set bits in a byte
+    inline constexpr auto popcount_lut = make_lut<256>([](size_t i) {
+        int count = 0;
+        for (; i != 0; i >>= 1)
+            count += static_cast<int>(i & 1);
+        return count;
+    });
+
+    // CRC-32 (IEEE 802.3, reflected polynomial 0xEDB88320)
+    inline constexpr auto crc32_lut = make_lut<256>([](size_t i) {
+        auto crc = static_cast<uint32_t>(i);
+        for (int bit = 0; bit < 8; ++bit)
+            crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320u : 0u);
+        return crc;
+    });
+
+    // gamma 2.2 decoding curve for 8-bit channels
+    inline constexpr auto gamma_lut = make_lut<256>([](size_t i) {
+        return Math::round(Math::pow(i / 255.0, 2.2) * 255.0);
+    });
+
+    // sin & cos in Q15 fixed-point: full circle divided into 256 steps
+    inline constexpr auto sin_q15_lut = make_lut<256>([](size_t i) {
+        return Math::round(Math::sin(2 * std::numbers::pi * static_cast<double>(i) / 256) * 32767);
+    });
+
+    constexpr int16_t sin_q15(uint8_t angle)
+    {
+        return sin_q15_lut[angle];
+    }
+
+    constexpr int16_t cos_q15(uint8_t angle)
+    {
+        return sin_q15_lut[static_cast<uint8_t>(angle + 64)]; // cos(x) = sin(x + pi/2)
+    }
+
+    constexpr uint32_t crc32(std::span<const std::byte> bytes, uint32_t crc = 0)
+    {
+        crc = ~crc;
+        for (const std::byte b : bytes)
+            crc = crc32_lut[(crc ^ std::to_integer<uint32_t>(b)) & 0xFF] ^ (crc >> 8);
+        return ~crc;
+    }
+} // namespace CompileTime
+
+#endif
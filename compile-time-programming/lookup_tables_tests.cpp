@@ -0,0 +1,144 @@
+#include "lookup_tables.hpp"
+
+#include <bit>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <numeric>
+#include <string_view>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("make_lut - generalized create_powers")
+{
+    constexpr auto lookup_squares = CompileTime::make_lut<12>([](size_t i) { return (i + 1) * (i + 1); });
+
+    static_assert(lookup_squares[3] == 16);
+    static_assert(std::is_same_v<decltype(lookup_squares)::value_type, uint8_t>); // max value 144 fits in a byte
+    static_assert(alignof(decltype(lookup_squares)) == CompileTime::lut_alignment);
+}
+
+TEST_CASE("make_lut - narrowest element type")
+{
+    constexpr auto small_signed = CompileTime::make_lut<4>([](size_t i) { return -static_cast<int>(i); });
+    static_assert(std::is_same_v<decltype(small_signed)::value_type, int8_t>);
+
+    constexpr auto wide_signed = CompileTime::make_lut<4>([](size_t i) { return static_cast<long long>(i) * -1'000; });
+    static_assert(std::is_same_v<decltype(wide_signed)::value_type, int16_t>);
+
+    constexpr auto unsigned_32 = CompileTime::make_lut<4>([](size_t i) { return i << 20; });
+    static_assert(std::is_same_v<decltype(unsigned_32)::value_type, uint32_t>);
+
+    constexpr auto halves = CompileTime::make_lut<4>([](size_t i) { return i / 2.0; });
+    static_assert(std::is_same_v<decltype(halves)::value_type, double>);
+    static_assert(halves[3] == 1.5);
+}
+
+TEST_CASE("built-in lookup tables")
+{
+    SECTION("popcount")
+    {
+        static_assert(std::is_same_v<decltype(CompileTime::popcount_lut)::value_type, uint8_t>);
+
+        for (unsigned i = 0; i < 256; ++i)
+            REQUIRE(CompileTime::popcount_lut[i] == std::popcount(i));
+    }
+
+    SECTION("crc32")
+    {
+        constexpr auto text = "123456789"sv;
+        static_assert(CompileTime::crc32_lut[1] == 0x77073096);
+
+        CHECK(CompileTime::crc32(std::as_bytes(std::span{text})) == 0xCBF43926); // standard check value
+    }
+
+    SECTION("gamma")
+    {
+        static_assert(CompileTime::gamma_lut[0] == 0);
+        static_assert(CompileTime::gamma_lut[255] == 255);
+
+        for (int i = 0; i < 256; ++i)
+            REQUIRE(CompileTime::gamma_lut[i] == std::lround(std::pow(i / 255.0, 2.2) * 255.0));
+    }
+
+    SECTION("sin & cos - Q15")
+    {
+        static_assert(std::is_same_v<decltype(CompileTime::sin_q15_lut)::value_type, int16_t>);
+        static_assert(CompileTime::sin_q15(64) == 32767);
+        static_assert(CompileTime::cos_q15(128) == -32767);
+
+        for (int i = 0; i < 256; ++i)
+            REQUIRE(CompileTime::sin_q15_lut[i] == std::lround(std::sin(2 * std::numbers::pi * i / 256) * 32767));
+    }
+}
+
+namespace
+{
+    uint32_t crc32_bitwise(std::span<const std::byte> bytes)
+    {
+        uint32_t crc = ~0u;
+        for (const std::byte b : bytes)
+        {
+            crc ^= std::to_integer<uint32_t>(b);
+            for (int bit = 0; bit < 8; ++bit)
+                crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320u : 0u);
+        }
+        return ~crc;
+    }
+} // namespace
+
+TEST_CASE("lookup tables - benchmark", "[.][benchmark]")
+{
+    std::vector<uint8_t> data(1'000'000);
+    std::iota(data.begin(), data.end(), 0);
+    const auto bytes = std::as_bytes(std::span{data});
+
+    BENCHMARK("popcount - std::popcount")
+    {
+        return std::accumulate(data.begin(), data.end(), 0, [](int sum, uint8_t x) { return sum + std::popcount(x); });
+    };
+
+    BENCHMARK("popcount - LUT")
+    {
+        return std::accumulate(data.begin(), data.end(), 0, [](int sum, uint8_t x) { return sum + CompileTime::popcount_lut[x]; });
+    };
+
+    BENCHMARK("crc32 - bitwise")
+    {
+        return crc32_bitwise(bytes);
+    };
+
+    BENCHMARK("crc32 - LUT")
+    {
+        return CompileTime::crc32(bytes);
+    };
+
+    std::vector<uint8_t> pixels(data.size());
+
+    BENCHMARK("gamma - std::pow")
+    {
+        std::ranges::transform(data, pixels.begin(), [](uint8_t x) { return static_cast<uint8_t>(std::lround(std::pow(x / 255.0, 2.2) * 255.0)); });
+        return pixels.data();
+    };
+
+    BENCHMARK("gamma - LUT")
+    {
+        std::ranges::transform(data, pixels.begin(), [](uint8_t x) { return CompileTime::gamma_lut[x]; });
+        return pixels.data();
+    };
+
+    std::vector<int16_t> samples(data.size());
+
+    BENCHMARK("sin Q15 - std::sin")
+    {
+        std::ranges::transform(data, samples.begin(), [](uint8_t x) { return static_cast<int16_t>(std::lround(std::sin(2 * std::numbers::pi * x / 256) * 32767)); });
+        return samples.data();
+    };
+
+    BENCHMARK("sin Q15 - LUT")
+    {
+        std::ranges::transform(data, samples.begin(), [](uint8_t x) { return CompileTime::sin_q15(x); });
+        return samples.data();
+    };
+}
@@ -0,0 +1,197 @@
+#ifndef PERFECT_MAP_HPP
+#define PERFECT_MAP_HPP
+
+#include "hash_mix.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////
+// Compile-time perfect hash maps
+//
+// constinit auto colors = make_perfect_map<std::string_view, Color>({{"red", Color::red}, {"green", Color::green}});
+// const Color* c = colors.find("red");
+//
+// The table is built by a consteval "hash and displace" search: keys are grouped in buckets by
+// their hash, then every bucket gets a displacement that sends all its keys to free slots.
+// Lookup = one key hash + one mix + one key comparison - no probing, no runtime construction.
+// Duplicated keys (equal hashes & equal keys) are detected before the search and fail the compilation.
+
+namespace CompileTime
+{
+    template <typename TKey>
+    struct PerfectHash;
+
+    template <typename TKey>
+        requires std::integral<TKey> || std::is_enum_v<TKey>
+    struct PerfectHash<TKey>
+    {
+        constexpr uint64_t operator()(TKey key) const
+        {
+            if constexpr (std::is_enum_v<TKey>)
+                return Hashing::mix64(static_cast<uint64_t>(static_cast<std::underlying_type_t<TKey>>(key)));
+            else
+                return Hashing::mix64(static_cast<uint64_t>(key));
+        }
+    };
+
+    template <>
+    struct PerfectHash<std::string_view>
+    {
+        constexpr uint64_t operator()(std::string_view key) const
+        {
+            uint64_t h = 0xCBF29CE484222325ull; // FNV-1a
+            for (const char c : key)
+            {
+                h ^= static_cast<uint8_t>(c);
+                h *= 0x100000001B3ull;
+            }
+            return Hashing::mix64(h);
+        }
+    };
+
+    template <typename TKey, typename TValue, size_t N, typename THash = PerfectHash<TKey>>
+        requires std::default_initializable<TKey> && std::default_initializable<TValue>
+    class PerfectMap
+    {
+    public:
+        static constexpr size_t capacity = std::bit_ceil(N);
+
+    private:
+        static constexpr size_t mask = capacity - 1;
+
+        std::array<TKey, capacity> keys_{};
+        std::array<TValue, capacity> values_{};
+        std::array<uint32_t, capacity> displacements_{};
+        std::array<bool, capacity> used_{};
+
+        static constexpr size_t slot_of(uint64_t hash, uint32_t displacement)
+        {
+            return static_cast<size_t>(Hashing::mix64(hash + displacement * 0x9E3779B97F4A7C15ull)) & mask;
+        }
+
+    public:
+        consteval explicit PerfectMap(std::span<const std::pair<TKey, TValue>, N> entries)
+        {
+            constexpr uint32_t max_displacement = 1'000'000;
+
+            std::vector<uint64_t> hashes(N);
+            std::vector<std::vector<size_t>> buckets(capacity);
+            for (size_t i = 0; i < N; ++i)
+            {
+                hashes[i] = THash{}(entries[i].first);
+                buckets[hashes[i] & mask].push_back(i);
+            }
+
+            // keys with equal hashes collide for every displacement - reject them before the search
+            std::vector<size_t> by_hash(N);
+            for (size_t i = 0; i < N; ++i)
+                by_hash[i] = i;
+            std::ranges::sort(by_hash, {}, [&](size_t i) { return hashes[i]; });
+            for (size_t k = 1; k < N; ++k)
+            {
+                if (hashes[by_hash[k - 1]] == hashes[by_hash[k]])
+                {
+                    if (entries[by_hash[k - 1]].first == entries[by_hash[k]].first)
+                        throw std::logic_error("duplicated key in PerfectMap");
+                    throw std::logic_error("64-bit hash collision of distinct keys in PerfectMap");
+                }
+            }
+
+            // largest buckets first - they are hardest to place
+            std::vector<size_t> bucket_order(capacity);
+            for (size_t b = 0; b < capacity; ++b)
+                bucket_order[b] = b;
+            std::ranges::sort(bucket_order, [&](size_t a, size_t b) {
+                return buckets[a].size() != buckets[b].size() ? buckets[a].size() > buckets[b].size() : a < b;
+            });
+
+            for (const size_t b : bucket_order)
+            {
+                const auto& bucket = buckets[b];
+                if (bucket.empty())
+                    break;
+
+                for (uint32_t displacement = 0;; ++displacement)
+                {
+                    if (displacement == max_displacement)
+                        throw std::logic_error("perfect hash not found");
+
+                    std::vector<size_t> slots;
+                    bool placed = true;
+                    for (const size_t i : bucket)
+                    {
+                        const size_t slot = slot_of(hashes[i], displacement);
+                        if (used_[slot] || std::ranges::find(slots, slot) != slots.end())
+                        {
+                            placed = false;
+                            break;
+                        }
+                        slots.push_back(slot);
+                    }
+
+                    if (placed)
+                    {
+                        displacements_[b] = displacement;
+                        for (size_t k = 0; k < bucket.size(); ++k)
+                        {
+                            used_[slots[k]] = true;
+                            keys_[slots[k]] = entries[bucket[k]].first;
+                            values_[slots[k]] = entries[bucket[k]].second;
+                        }
+                        break;
+                    }
+                }
+            }
+        }
+
+        constexpr const TValue* find(const TKey& key) const
+        {
+            const uint64_t hash = THash{}(key);
+            const size_t slot = slot_of(hash, displacements_[hash & mask]);
+            return (used_[slot] && keys_[slot] == key) ? &values_[slot] : nullptr;
+        }
+
+        constexpr bool contains(const TKey& key) const
+        {
+            return find(key) != nullptr;
+        }
+
+        constexpr const TValue& at(const TKey& key) const
+        {
+            if (const TValue* value = find(key))
+                return *value;
+            throw std::out_of_range("key not found in PerfectMap");
+        }
+
+        static constexpr size_t size()
+        {
+            return N;
+        }
+    };
+
+    template <typename TKey, typename TValue, size_t N>
+    consteval auto make_perfect_map(const std::pair<TKey, TValue> (&entries)[N])
+    {
+        return PerfectMap<TKey, TValue, N>{entries};
+    }
+
+    // entries generated by a constexpr function
+    template <typename TKey, typename TValue, size_t N>
+    consteval auto make_perfect_map(const std::array<std::pair<TKey, TValue>, N>& entries)
+    {
+        return PerfectMap<TKey, TValue, N>{entries};
+    }
+} // namespace CompileTime
+
+#endif
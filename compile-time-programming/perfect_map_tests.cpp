@@ -0,0 +1,221 @@
+#include "perfect_map.hpp"
+
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    enum class HttpMethod
+    {
+        unknown,
+        get,
+        head,
+        post,
+        put,
+        delete_,
+        connect,
+        options,
+        trace,
+        patch
+    };
+
+    constinit auto http_methods = CompileTime::make_perfect_map<std::string_view, HttpMethod>({
+        {"GET", HttpMethod::get},
+        {"HEAD", HttpMethod::head},
+        {"POST", HttpMethod::post},
+        {"PUT", HttpMethod::put},
+        {"DELETE", HttpMethod::delete_},
+        {"CONNECT", HttpMethod::connect},
+        {"OPTIONS", HttpMethod::options},
+        {"TRACE", HttpMethod::trace},
+        {"PATCH", HttpMethod::patch},
+    });
+
+    HttpMethod http_method_if_chain(std::string_view name)
+    {
+        if (name == "GET")
+            return HttpMethod::get;
+        if (name == "HEAD")
+            return HttpMethod::head;
+        if (name == "POST")
+            return HttpMethod::post;
+        if (name == "PUT")
+            return HttpMethod::put;
+        if (name == "DELETE")
+            return HttpMethod::delete_;
+        if (name == "CONNECT")
+            return HttpMethod::connect;
+        if (name == "OPTIONS")
+            return HttpMethod::options;
+        if (name == "TRACE")
+            return HttpMethod::trace;
+        if (name == "PATCH")
+            return HttpMethod::patch;
+        return HttpMethod::unknown;
+    }
+
+    std::unordered_map<std::string_view, HttpMethod> make_http_methods_unordered_map()
+    {
+        return {
+            {"GET", HttpMethod::get},
+            {"HEAD", HttpMethod::head},
+            {"POST", HttpMethod::post},
+            {"PUT", HttpMethod::put},
+            {"DELETE", HttpMethod::delete_},
+            {"CONNECT", HttpMethod::connect},
+            {"OPTIONS", HttpMethod::options},
+            {"TRACE", HttpMethod::trace},
+            {"PATCH", HttpMethod::patch},
+        };
+    }
+
+    // a throw during constant evaluation makes the template argument invalid - a substitution failure
+    template <typename TBuildMap>
+    concept BuildsAtCompileTime = requires { typename std::integral_constant<size_t, TBuildMap{}().size()>; };
+
+    struct DuplicatedKeys
+    {
+        consteval auto operator()() const
+        {
+            return CompileTime::make_perfect_map<std::string_view, int>({{"GET", 1}, {"PUT", 2}, {"GET", 3}});
+        }
+    };
+
+    struct UniqueKeys
+    {
+        consteval auto operator()() const
+        {
+            return CompileTime::make_perfect_map<std::string_view, int>({{"GET", 1}, {"PUT", 2}, {"POST", 3}});
+        }
+    };
+} // namespace
+
+TEST_CASE("make_perfect_map - string_view keys")
+{
+    static_assert(decltype(http_methods)::size() == 9);
+    static_assert(decltype(http_methods)::capacity == 16);
+
+    REQUIRE(http_methods.find("POST") != nullptr);
+    CHECK(*http_methods.find("POST") == HttpMethod::post);
+    CHECK(http_methods.at("PATCH") == HttpMethod::patch);
+
+    CHECK_FALSE(http_methods.contains("post"));
+    CHECK_FALSE(http_methods.contains(""));
+    CHECK(http_methods.find("GETS") == nullptr);
+    CHECK_THROWS_AS(http_methods.at("BREW"), std::out_of_range);
+
+    SECTION("lookups with runtime strings")
+    {
+        const std::string name = "DEL"s + "ETE";
+        CHECK(http_methods.at(name) == HttpMethod::delete_);
+    }
+}
+
+TEST_CASE("make_perfect_map - integral keys")
+{
+    constexpr auto http_status = CompileTime::make_perfect_map<int, std::string_view>({
+        {200, "OK"},
+        {201, "Created"},
+        {204, "No Content"},
+        {301, "Moved Permanently"},
+        {304, "Not Modified"},
+        {400, "Bad Request"},
+        {404, "Not Found"},
+        {500, "Internal Server Error"},
+    });
+
+    static_assert(http_status.at(404) == "Not Found");
+    static_assert(http_status.contains(204));
+    static_assert(!http_status.contains(202));
+
+    CHECK(http_status.at(500) == "Internal Server Error");
+}
+
+TEST_CASE("make_perfect_map - every key of a larger set is found")
+{
+    constexpr auto entries = [] {
+        std::array<std::pair<uint32_t, uint32_t>, 200> entries{};
+        for (uint32_t i = 0; i < 200; ++i)
+            entries[i] = {i * 7919, i * i};
+        return entries;
+    }();
+
+    constexpr auto squares = CompileTime::make_perfect_map(entries);
+    static_assert(decltype(squares)::capacity == 256);
+
+    for (uint32_t i = 0; i < 200; ++i)
+    {
+        REQUIRE(squares.contains(i * 7919));
+        REQUIRE(squares.at(i * 7919) == i * i);
+    }
+
+    CHECK_FALSE(squares.contains(1));
+    CHECK_FALSE(squares.contains(7918));
+}
+
+TEST_CASE("make_perfect_map - duplicated keys are rejected at compile time")
+{
+    static_assert(BuildsAtCompileTime<UniqueKeys>);
+    static_assert(!BuildsAtCompileTime<DuplicatedKeys>);
+}
+
+TEST_CASE("make_perfect_map - benchmark", "[.][benchmark]")
+{
+    constexpr std::array names = {"GET"sv, "HEAD"sv, "POST"sv, "PUT"sv, "DELETE"sv, "CONNECT"sv, "OPTIONS"sv, "TRACE"sv, "PATCH"sv, "BREW"sv};
+
+    std::mt19937 rnd_gen{665};
+    std::uniform_int_distribution<size_t> distr(0, names.size() - 1);
+
+    std::vector<std::string_view> requests(10'000);
+    for (auto& request : requests)
+        request = names[distr(rnd_gen)];
+
+    const auto unordered_map = make_http_methods_unordered_map();
+
+    BENCHMARK("lookup - if chain")
+    {
+        int sum = 0;
+        for (const auto request : requests)
+            sum += static_cast<int>(http_method_if_chain(request));
+        return sum;
+    };
+
+    BENCHMARK("lookup - std::unordered_map")
+    {
+        int sum = 0;
+        for (const auto request : requests)
+        {
+            const auto it = unordered_map.find(request);
+            sum += static_cast<int>(it != unordered_map.end() ? it->second : HttpMethod::unknown);
+        }
+        return sum;
+    };
+
+    BENCHMARK("lookup - constinit perfect map")
+    {
+        int sum = 0;
+        for (const auto request : requests)
+        {
+            const HttpMethod* method = http_methods.find(request);
+            sum += static_cast<int>(method ? *method : HttpMethod::unknown);
+        }
+        return sum;
+    };
+
+    // startup cost: a std::unordered_map is built by dynamic initialization (allocations + hashing)
+    // when the program starts - the constinit perfect map is stored in .data and costs nothing
+    BENCHMARK("startup - std::unordered_map construction")
+    {
+        return make_http_methods_unordered_map();
+    };
+}
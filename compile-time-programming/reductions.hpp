@@ -0,0 +1,137 @@
+#ifndef REDUCTIONS_HPP
+#define REDUCTIONS_HPP
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <tuple>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////////////////////
+// Balanced (pairwise) reductions
+//
+// (... + args)               -> ((((a + b) + c) + d) + ...)  - every add waits for the previous one
+// tree_reduce(op, args...)   -> ((a + b) + (c + d)) + ...    - independent ops can execute in parallel
+//
+// tree_reduce requires only associativity of op - operands are never reordered. For floating point
+// the result may differ from a left fold in the last bits (pairwise summation is usually more accurate).
+
+namespace CompileTime
+{
+    namespace Detail
+    {
+        template <size_t First, size_t Count, typename TOp, typename TTuple>
+        constexpr decltype(auto) tree_reduce_tuple(TOp& op, TTuple&& args)
+        {
+            static_assert(Count > 0);
+
+            if constexpr (Count == 1)
+                return std::get<First>(std::forward<TTuple>(args));
+            else
+            {
+                constexpr size_t half = Count / 2;
+                return op(tree_reduce_tuple<First, half>(op, args), tree_reduce_tuple<First + half, Count - half>(op, args));
+            }
+        }
+
+        template <size_t First, size_t Count, typename T, size_t N, typename TOp>
+        constexpr T tree_reduce_array(TOp& op, const std::array<T, N>& items)
+        {
+            if constexpr (Count == 1)
+                return items[First];
+            else
+            {
+                constexpr size_t half = Count / 2;
+                return op(tree_reduce_array<First, half>(op, items), tree_reduce_array<First + half, Count - half>(op, items));
+            }
+        }
+    } // namespace Detail
+
+    template <typename TOp, typename... TArgs>
+        requires(sizeof...(TArgs) > 0)
+    constexpr auto tree_reduce(TOp op, TArgs... args)
+    {
+        return Detail::tree_reduce_tuple<0, sizeof...(TArgs)>(op, std::forward_as_tuple(std::move(args)...));
+    }
+
+    template <typename T, size_t N, typename TOp>
+        requires(N > 0)
+    constexpr T tree_reduce(TOp op, const std::array<T, N>& items)
+    {
+        return Detail::tree_reduce_array<0, N>(op, items);
+    }
+
+    template <typename... TArgs>
+    constexpr auto tree_sum(TArgs... args)
+    {
+        return tree_reduce(std::plus<>{}, std::move(args)...);
+    }
+
+    template <typename T, size_t N>
+    constexpr T tree_sum(const std::array<T, N>& items)
+    {
+        return tree_reduce(std::plus<>{}, items);
+    }
+
+    ///////////////////////////
+    // runtime reductions over spans
+    //
+    // Element i is accumulated in lane i % Lanes, so Lanes independent dependency chains run side by
+    // side over one sequential stream. Lanes regroup elements - op must be associative & commutative
+    // (+, *, min, max, bitwise ops).
+
+    template <size_t Lanes = 4, typename T, typename TOp = std::plus<>>
+        requires(Lanes > 0) && std::invocable<TOp&, T, T>
+    constexpr T reduce(std::span<const T> items, T init, TOp op = {})
+    {
+        const size_t unrolled_size = items.size() - items.size() % Lanes;
+
+        if (unrolled_size == 0)
+        {
+            for (const T& item : items)
+                init = op(init, item);
+            return init;
+        }
+
+        std::array<T, Lanes> accumulators;
+        for (size_t lane = 0; lane < Lanes; ++lane)
+            accumulators[lane] = items[lane];
+
+        for (size_t i = Lanes; i < unrolled_size; i += Lanes)
+            for (size_t lane = 0; lane < Lanes; ++lane) // unrolled by the compiler - Lanes is a constant
+                accumulators[lane] = op(accumulators[lane], items[i + lane]);
+
+        for (size_t i = unrolled_size; i < items.size(); ++i)
+            accumulators[i - unrolled_size] = op(accumulators[i - unrolled_size], items[i]);
+
+        return op(init, tree_reduce(op, accumulators));
+    }
+
+    template <size_t Lanes = 4, typename T>
+    constexpr T sum(std::span<const T> items)
+    {
+        return reduce<Lanes>(items, T{});
+    }
+
+    ///////////////////////////
+    // fixed-size vector math
+
+    template <typename T, size_t N>
+    constexpr T dot(const std::array<T, N>& a, const std::array<T, N>& b)
+    {
+        std::array<T, N> products{};
+        for (size_t i = 0; i < N; ++i)
+            products[i] = a[i] * b[i];
+        return tree_sum(products);
+    }
+
+    template <typename T, size_t N>
+    constexpr T squared_norm(const std::array<T, N>& a)
+    {
+        return dot(a, a);
+    }
+} // namespace CompileTime
+
+#endif
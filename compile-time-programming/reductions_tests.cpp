@@ -0,0 +1,111 @@
+#include "reductions.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    // associative but not commutative
+    struct Matrix2x2
+    {
+        long long a, b, c, d;
+
+        friend constexpr Matrix2x2 operator*(const Matrix2x2& x, const Matrix2x2& y)
+        {
+            return {x.a * y.a + x.b * y.c, x.a * y.b + x.b * y.d, x.c * y.a + x.d * y.c, x.c * y.b + x.d * y.d};
+        }
+
+        bool operator==(const Matrix2x2&) const = default;
+    };
+} // namespace
+
+TEST_CASE("tree_reduce - variadic")
+{
+    static_assert(CompileTime::tree_sum(1, 2, 3, 4) == 10);
+    static_assert(CompileTime::tree_sum(1, 5, 6, 7, 8) == 27);
+    static_assert(CompileTime::tree_sum(42) == 42);
+    static_assert(CompileTime::tree_reduce([](int x, int y) { return std::max(x, y); }, 3, 9, 1, 7) == 9);
+
+    SECTION("mixed types")
+    {
+        static_assert(CompileTime::tree_sum(1, 2.5, 3u, 4LL) == 10.5);
+    }
+
+    SECTION("operand order is preserved")
+    {
+        const auto text = CompileTime::tree_sum("a"s, "b"s, "c"s, "d"s, "e"s);
+        CHECK(text == "abcde");
+
+        constexpr Matrix2x2 fib{1, 1, 1, 0};
+        constexpr Matrix2x2 swap{0, 1, 1, 0};
+        static_assert(CompileTime::tree_reduce(std::multiplies<>{}, fib, swap, fib, fib, swap) == fib * swap * fib * fib * swap);
+    }
+}
+
+TEST_CASE("tree_reduce - std::array")
+{
+    constexpr std::array<int, 7> items = {1, 2, 3, 4, 5, 6, 7};
+    static_assert(CompileTime::tree_sum(items) == 28);
+    static_assert(CompileTime::tree_reduce(std::multiplies<>{}, items) == 5040);
+
+    constexpr std::array v = {1.0, 2.0, 2.0};
+    static_assert(CompileTime::dot(v, v) == 9.0);
+    static_assert(CompileTime::squared_norm(std::array{3, 4}) == 25);
+}
+
+TEST_CASE("reduce - span with multiple accumulators")
+{
+    for (size_t size : {0, 1, 3, 4, 5, 17, 1000, 1003})
+    {
+        std::vector<int> items(size);
+        std::iota(items.begin(), items.end(), 1);
+
+        CHECK(CompileTime::sum(std::span<const int>{items}) == std::accumulate(items.begin(), items.end(), 0));
+        CHECK(CompileTime::reduce<8>(std::span<const int>{items}, 100) == std::accumulate(items.begin(), items.end(), 100));
+    }
+
+    SECTION("custom op")
+    {
+        const std::vector<int> items = {4, -8, 15, 16, -23, 42, 7};
+        CHECK(CompileTime::reduce(std::span<const int>{items}, 0, [](int x, int y) { return std::max(x, y); }) == 42);
+        CHECK(CompileTime::reduce<2>(std::span<const int>{items}, 0, [](int x, int y) { return std::min(x, y); }) == -23);
+    }
+
+    SECTION("constexpr")
+    {
+        constexpr std::array items = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+        static_assert(CompileTime::sum<3>(std::span<const int>{items}) == 55);
+    }
+}
+
+TEST_CASE("reduce - benchmark", "[.][benchmark]")
+{
+    std::mt19937 rnd_gen{665};
+    std::uniform_real_distribution<double> distr(0.0, 1.0);
+
+    std::vector<double> data(1'000'000);
+    std::ranges::generate(data, [&] { return distr(rnd_gen); });
+    const std::span<const double> items{data};
+
+    BENCHMARK("std::accumulate - single dependency chain")
+    {
+        return std::accumulate(items.begin(), items.end(), 0.0);
+    };
+
+    BENCHMARK("reduce - 4 accumulators")
+    {
+        return CompileTime::reduce<4>(items, 0.0);
+    };
+
+    BENCHMARK("reduce - 8 accumulators")
+    {
+        return CompileTime::reduce<8>(items, 0.0);
+    };
+}
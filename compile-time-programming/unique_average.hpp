@@ -0,0 +1,235 @@
+#ifndef UNIQUE_AVERAGE_HPP
+#define UNIQUE_AVERAGE_HPP
+
+#include "hash_mix.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////
+// Mean of distinct values
+//
+// avg_for_unique_sorted   - sort + unique: O(n log n), constexpr
+// avg_for_unique_hashed   - flat hash set: O(n), single pass - works for input ranges without size()
+// avg_for_unique_parallel - per-shard dedup, values partitioned by hash & merged in parallel
+//
+// The hashed variants sum in hash order - they are defined for integral values only, so that every variant
+// returns exactly the same result (a floating point sum depends on the order of items).
+
+namespace Stats
+{
+    // open addressing with linear probing - values & occupancy flags in flat arrays
+    template <typename T, typename THash = std::hash<T>>
+    class FlatHashSet
+    {
+        std::vector<T> slots_;
+        std::vector<uint8_t> used_;
+        size_t size_ = 0;
+        size_t mask_ = 0;
+
+        static constexpr size_t min_capacity = 16;
+
+        size_t capacity() const
+        {
+            return slots_.size();
+        }
+
+        void rehash(size_t new_capacity)
+        {
+            std::vector<T> old_slots(new_capacity);
+            std::vector<uint8_t> old_used(new_capacity);
+            old_slots.swap(slots_);
+            old_used.swap(used_);
+            mask_ = new_capacity - 1;
+            size_ = 0;
+
+            for (size_t i = 0; i < old_slots.size(); ++i)
+                if (old_used[i])
+                    insert(std::move(old_slots[i]));
+        }
+
+    public:
+        FlatHashSet() = default;
+
+        explicit FlatHashSet(size_t expected_size)
+        {
+            reserve(expected_size);
+        }
+
+        static size_t hash_of(const T& value)
+        {
+            return static_cast<size_t>(Hashing::mix64(THash{}(value)));
+        }
+
+        void reserve(size_t expected_size)
+        {
+            const size_t required = std::bit_ceil(std::max(min_capacity, expected_size + expected_size / 2 + 1)); // load factor <= 2/3
+            if (required > capacity())
+                rehash(required);
+        }
+
+        // returns true if value was inserted (was not present in the set)
+        bool insert(const T& value)
+        {
+            if ((size_ + 1) * 3 > capacity() * 2)
+                rehash(std::max(min_capacity, capacity() * 2));
+
+            for (size_t index = hash_of(value) & mask_;; index = (index + 1) & mask_)
+            {
+                if (!used_[index])
+                {
+                    slots_[index] = value;
+                    used_[index] = 1;
+                    ++size_;
+                    return true;
+                }
+
+                if (slots_[index] == value)
+                    return false;
+            }
+        }
+
+        bool contains(const T& value) const
+        {
+            if (size_ == 0)
+                return false;
+
+            for (size_t index = hash_of(value) & mask_; used_[index]; index = (index + 1) & mask_)
+            {
+                if (slots_[index] == value)
+                    return true;
+            }
+            return false;
+        }
+
+        size_t size() const
+        {
+            return size_;
+        }
+
+        template <typename F>
+        void for_each(F f) const
+        {
+            for (size_t i = 0; i < slots_.size(); ++i)
+                if (used_[i])
+                    f(slots_[i]);
+        }
+    };
+
+    template <std::ranges::input_range... TRng_>
+    constexpr auto avg_for_unique_sorted(const TRng_&... rng)
+    {
+        using TElement = std::common_type_t<std::ranges::range_value_t<TRng_>...>;
+
+        std::vector<TElement> vec;                            // empty vector
+        vec.reserve((... + rng.size()));                      // reserve a buffer
+        (vec.insert(vec.end(), rng.begin(), rng.end()), ...); // fold expression C++17
+
+        // sort items
+        std::ranges::sort(vec); // std::sort(vec.begin(), vec.end());
+
+        // create span of unique_items
+        auto new_end = std::unique(vec.begin(), vec.end());
+        std::span unique_items{vec.begin(), new_end};
+
+        // calculate sum of unique items
+        auto sum = std::accumulate(unique_items.begin(), unique_items.end(), TElement{});
+
+        return sum / static_cast<double>(unique_items.size());
+    }
+
+    // single pass over every range - ranges may be non-sized input ranges (e.g. std::views::istream)
+    template <std::ranges::input_range... TRng_>
+        requires std::integral<std::common_type_t<std::ranges::range_value_t<TRng_>...>>
+    auto avg_for_unique_hashed(TRng_&&... rng)
+    {
+        using TElement = std::common_type_t<std::ranges::range_value_t<TRng_>...>;
+
+        FlatHashSet<TElement> unique_items;
+        if constexpr ((std::ranges::sized_range<TRng_> && ...))
+            unique_items.reserve((... + std::ranges::size(rng)));
+
+        TElement sum{};
+        auto accumulate_unique = [&](auto&& range) {
+            for (auto&& item : range)
+            {
+                const TElement value = item;
+                if (unique_items.insert(value))
+                    sum += value;
+            }
+        };
+        (accumulate_unique(rng), ...);
+
+        return sum / static_cast<double>(unique_items.size());
+    }
+
+    template <std::ranges::random_access_range TRng_>
+        requires std::ranges::sized_range<TRng_> && std::integral<std::ranges::range_value_t<TRng_>>
+    auto avg_for_unique_parallel(const TRng_& rng, unsigned threads_count = std::max(1u, std::thread::hardware_concurrency()))
+    {
+        using TElement = std::ranges::range_value_t<TRng_>;
+
+        const size_t size = std::ranges::size(rng);
+        const size_t shards_count = std::clamp<size_t>(threads_count, 1, std::max<size_t>(1, size / 4096));
+        const auto partition_of = [shards_count](size_t hash) { return (hash >> (4 * sizeof(size_t))) % shards_count; };
+
+        // phase 1: every shard dedups its chunk & splits unique values into partitions by hash
+        std::vector<std::vector<std::vector<TElement>>> partitions(shards_count, std::vector<std::vector<TElement>>(shards_count));
+        {
+            std::vector<std::jthread> threads;
+            for (size_t shard = 0; shard < shards_count; ++shard)
+            {
+                threads.emplace_back([&, shard] {
+                    const size_t first = size * shard / shards_count;
+                    const size_t last = size * (shard + 1) / shards_count;
+
+                    FlatHashSet<TElement> local_unique(last - first);
+                    for (size_t i = first; i < last; ++i)
+                        local_unique.insert(rng[i]);
+
+                    auto& out = partitions[shard];
+                    local_unique.for_each([&](const TElement& value) {
+                        out[partition_of(FlatHashSet<TElement>::hash_of(value))].push_back(value);
+                    });
+                });
+            }
+        }
+
+        // phase 2: partitions are disjoint - each one is merged & summed independently
+        std::vector<TElement> sums(shards_count);
+        std::vector<size_t> counts(shards_count);
+        {
+            std::vector<std::jthread> threads;
+            for (size_t partition = 0; partition < shards_count; ++partition)
+            {
+                threads.emplace_back([&, partition] {
+                    FlatHashSet<TElement> unique_items;
+                    TElement sum{};
+                    for (size_t shard = 0; shard < shards_count; ++shard)
+                        for (const auto& value : partitions[shard][partition])
+                            if (unique_items.insert(value))
+                                sum += value;
+                    sums[partition] = sum;
+                    counts[partition] = unique_items.size();
+                });
+            }
+        }
+
+        const auto sum = std::accumulate(sums.begin(), sums.end(), TElement{});
+        const auto count = std::accumulate(counts.begin(), counts.end(), size_t{});
+
+        return sum / static_cast<double>(count);
+    }
+} // namespace Stats
+
+#endif
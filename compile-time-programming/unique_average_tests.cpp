@@ -0,0 +1,103 @@
+#include "unique_average.hpp"
+
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <list>
+#include <random>
+#include <ranges>
+#include <sstream>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("FlatHashSet")
+{
+    Stats::FlatHashSet<int> set;
+
+    CHECK(set.insert(42));
+    CHECK(set.insert(-7));
+    CHECK_FALSE(set.insert(42));
+
+    for (int i = 0; i < 1000; ++i)
+        set.insert(i);
+
+    CHECK(set.size() == 1001);
+    CHECK(set.contains(999));
+    CHECK(set.contains(-7));
+    CHECK_FALSE(set.contains(1000));
+}
+
+TEST_CASE("avg_for_unique - hashed & sorted give the same results")
+{
+    constexpr std::array lst1 = {1, 2, 3, 4, 5};
+    constexpr std::array lst2 = {5, 6, 7, 8, 9};
+
+    static_assert(Stats::avg_for_unique_sorted(lst1, lst2) == 5.0);
+
+    CHECK(Stats::avg_for_unique_hashed(lst1, lst2) == 5.0);
+
+    SECTION("mixed element types")
+    {
+        std::vector<int> vec = {1, 1, 2, 2, 3};
+        std::list<long> lst = {3, 4, 4};
+
+        CHECK(Stats::avg_for_unique_hashed(vec, lst) == Stats::avg_for_unique_sorted(vec, lst));
+    }
+
+    SECTION("streaming - input range without size")
+    {
+        std::istringstream input{"1 2 2 3 3 3 10"};
+
+        CHECK(Stats::avg_for_unique_hashed(std::views::istream<int>(input)) == 4.0);
+
+        auto evens = std::views::iota(0, 100) | std::views::filter([](int x) { return x % 2 == 0; });
+        static_assert(!std::ranges::sized_range<decltype(evens)>);
+        CHECK(Stats::avg_for_unique_hashed(evens, evens) == 49.0);
+    }
+}
+
+template <typename TRange>
+concept AveragedByHash = requires(const TRange& rng) { Stats::avg_for_unique_hashed(rng); };
+
+static_assert(AveragedByHash<std::vector<long>>);
+static_assert(!AveragedByHash<std::vector<double>>); // sum in hash order would differ from sorted order
+
+TEST_CASE("avg_for_unique - parallel")
+{
+    std::mt19937 rnd_gen{665};
+    std::uniform_int_distribution<long long> distr(0, 50'000);
+
+    std::vector<long long> data(200'000);
+    std::ranges::generate(data, [&] { return distr(rnd_gen); });
+
+    const auto expected = Stats::avg_for_unique_sorted(data);
+
+    CHECK(Stats::avg_for_unique_hashed(data) == expected);
+    CHECK(Stats::avg_for_unique_parallel(data, 4) == expected);
+    CHECK(Stats::avg_for_unique_parallel(std::vector{1, 2, 2, 3}) == 2.0);
+}
+
+TEST_CASE("avg_for_unique - benchmark", "[.][benchmark]")
+{
+    std::mt19937 rnd_gen{665};
+    std::uniform_int_distribution<int> distr(0, 1'000'000);
+
+    std::vector<int> data(1'000'000);
+    std::ranges::generate(data, [&] { return distr(rnd_gen); });
+
+    BENCHMARK("sort + unique")
+    {
+        return Stats::avg_for_unique_sorted(data);
+    };
+
+    BENCHMARK("flat hash set")
+    {
+        return Stats::avg_for_unique_hashed(data);
+    };
+
+    BENCHMARK("parallel - sharded hash sets")
+    {
+        return Stats::avg_for_unique_parallel(data);
+    };
+}
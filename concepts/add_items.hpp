@@ -0,0 +1,137 @@
+#ifndef ADD_ITEMS_HPP
+#define ADD_ITEMS_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////////////////////
+// Bulk insertion - add_items(container, range)
+//
+// The best available path is chosen by concepts describing container capabilities:
+//
+//  1. append_range (C++23 containers)                              -> c.append_range(rng)
+//  2. ordered associative (std::set, std::map) + sorted input      -> emplace_hint after the previously
+//                                                                     inserted item - amortized O(1) per item
+//  3. hashed associative (std::unordered_*)                        -> reserve + insert (no rehashing)
+//  4. sequence with insert(pos, first, last)                       -> single range insert - one allocation,
+//                                                                     memmove for trivially copyable items,
+//                                                                     correct when items alias the container
+//  5. fallback                                                     -> push_back or insert item by item
+
+namespace Containers
+{
+    template <typename TContainer>
+    concept Reservable = requires(TContainer& c, size_t n) { c.reserve(n); };
+
+    template <typename TContainer, typename TRange>
+    concept AppendRange = requires(TContainer& c, TRange&& rng) { c.append_range(std::forward<TRange>(rng)); };
+
+    template <typename TContainer>
+    concept OrderedAssociative = requires(TContainer& c, const typename TContainer::key_type& key) {
+        typename TContainer::key_compare;
+        c.key_comp();
+        { c.lower_bound(key) } -> std::same_as<typename TContainer::iterator>;
+    };
+
+    template <typename TContainer>
+    concept HashedAssociative = Reservable<TContainer> && requires {
+        typename TContainer::key_type;
+        typename TContainer::hasher;
+    };
+
+    template <typename TContainer, typename TIterator>
+    concept RangeInsertable = requires(TContainer& c, TIterator it) { c.insert(c.end(), it, it); };
+
+    namespace Detail
+    {
+        // reserves space keeping geometric growth - repeated bulk adds stay amortized O(1) per item
+        template <typename TContainer>
+        void grow_for(TContainer& c, size_t count)
+        {
+            const size_t required = c.size() + count;
+            if constexpr (requires { c.capacity(); })
+            {
+                if (required > c.capacity())
+                    c.reserve(std::max(required, 2 * c.capacity()));
+            }
+            else
+                c.reserve(required);
+        }
+
+        template <typename TContainer>
+        decltype(auto) key_of(const auto& item)
+        {
+            if constexpr (requires { typename TContainer::mapped_type; })
+                return (item.first);
+            else
+                return (item);
+        }
+
+        template <typename TContainer, typename TItem>
+        void add_one(TContainer& c, TItem&& item)
+        {
+            if constexpr (requires { c.push_back(std::forward<TItem>(item)); })
+                c.push_back(std::forward<TItem>(item));
+            else
+                c.insert(std::forward<TItem>(item));
+        }
+    } // namespace Detail
+
+    template <typename TContainer, std::ranges::input_range TRange>
+    void add_items(TContainer& container, TRange&& items)
+    {
+        using namespace Detail;
+
+        if constexpr (AppendRange<TContainer, TRange>)
+        {
+            container.append_range(std::forward<TRange>(items));
+        }
+        else if constexpr (OrderedAssociative<TContainer>)
+        {
+            if constexpr (std::ranges::forward_range<TRange>)
+            {
+                const auto by_key = [](const auto& item) -> decltype(auto) { return key_of<TContainer>(item); };
+                if (std::ranges::is_sorted(items, container.key_comp(), by_key))
+                {
+                    // sorted input: every item goes right after the previous one
+                    auto hint = container.end();
+                    for (auto&& item : items)
+                        hint = std::next(container.emplace_hint(hint, std::forward<decltype(item)>(item)));
+                    return;
+                }
+            }
+
+            for (auto&& item : items)
+                container.insert(std::forward<decltype(item)>(item));
+        }
+        else if constexpr (HashedAssociative<TContainer>)
+        {
+            if constexpr (std::ranges::sized_range<TRange>)
+                container.reserve(container.size() + std::ranges::size(items));
+
+            for (auto&& item : items)
+                container.insert(std::forward<decltype(item)>(item));
+        }
+        else if constexpr (RangeInsertable<TContainer, std::ranges::iterator_t<TRange>> && std::ranges::common_range<TRange>)
+        {
+            if constexpr (Reservable<TContainer> && std::ranges::sized_range<TRange> && !std::ranges::forward_range<TRange>)
+                grow_for(container, std::ranges::size(items)); // insert can't compute the distance for input iterators
+
+            container.insert(container.end(), std::ranges::begin(items), std::ranges::end(items));
+        }
+        else
+        {
+            if constexpr (Reservable<TContainer> && std::ranges::sized_range<TRange>)
+                grow_for(container, std::ranges::size(items));
+
+            for (auto&& item : items)
+                add_one(container, std::forward<decltype(item)>(item));
+        }
+    }
+} // namespace Containers
+
+#endif
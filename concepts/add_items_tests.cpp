@@ -0,0 +1,196 @@
+#include "add_items.hpp"
+
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <deque>
+#include <list>
+#include <map>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <set>
+#include <span>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+using namespace std::literals;
+
+static_assert(Containers::RangeInsertable<std::vector<int>, std::array<int, 3>::iterator>);
+static_assert(Containers::OrderedAssociative<std::set<int>>);
+static_assert(Containers::OrderedAssociative<std::map<int, std::string>>);
+static_assert(Containers::HashedAssociative<std::unordered_set<int>>);
+static_assert(!Containers::OrderedAssociative<std::unordered_set<int>>);
+static_assert(Containers::RangeInsertable<std::list<int>, std::vector<int>::iterator>);
+
+TEST_CASE("add_items - sequences")
+{
+    SECTION("vector & contiguous trivially copyable source")
+    {
+        std::vector<int> vec = {1, 2};
+        Containers::add_items(vec, std::array{3, 4, 5});
+        Containers::add_items(vec, std::vector<int>{});
+        CHECK(vec == std::vector{1, 2, 3, 4, 5});
+    }
+
+    SECTION("vector & part of itself - source is read before reallocation")
+    {
+        std::vector<int> vec = {1, 2, 3};
+        vec.shrink_to_fit();
+        Containers::add_items(vec, std::span{vec}.first(2));
+        CHECK(vec == std::vector{1, 2, 3, 1, 2});
+    }
+
+    SECTION("vector & lazy view")
+    {
+        std::vector<int> vec;
+        Containers::add_items(vec, std::views::iota(1, 6) | std::views::filter([](int x) { return x % 2; }));
+        CHECK(vec == std::vector{1, 3, 5});
+    }
+
+    SECTION("vector of strings")
+    {
+        std::vector<std::string> words = {"one"};
+        const std::list<std::string> more = {"two", "three"};
+        Containers::add_items(words, more);
+        CHECK(words == std::vector{"one"s, "two"s, "three"s});
+    }
+
+    SECTION("list & deque")
+    {
+        std::list<int> lst = {1};
+        Containers::add_items(lst, std::vector{2, 3});
+        CHECK(lst == std::list{1, 2, 3});
+
+        std::deque<int> dq = {1};
+        Containers::add_items(dq, std::vector{2, 3});
+        CHECK(dq == std::deque{1, 2, 3});
+    }
+
+    SECTION("input range")
+    {
+        std::istringstream in{"1 2 3"};
+        std::vector<int> vec;
+        Containers::add_items(vec, std::views::istream<int>(in));
+        CHECK(vec == std::vector{1, 2, 3});
+    }
+}
+
+TEST_CASE("add_items - associative containers")
+{
+    SECTION("set - sorted input")
+    {
+        std::set<int> set = {0, 5, 100};
+        Containers::add_items(set, std::vector{1, 2, 3, 5, 6, 200});
+        CHECK(set == std::set{0, 1, 2, 3, 5, 6, 100, 200});
+    }
+
+    SECTION("set - unsorted input")
+    {
+        std::set<int> set = {10};
+        Containers::add_items(set, std::vector{3, 1, 2, 1});
+        CHECK(set == std::set{1, 2, 3, 10});
+    }
+
+    SECTION("map - sorted by key")
+    {
+        std::map<int, std::string> dict = {{2, "two"}};
+        Containers::add_items(dict, std::vector<std::pair<int, std::string>>{{1, "one"}, {2, "dwa"}, {3, "three"}});
+        CHECK(dict == std::map<int, std::string>{{1, "one"}, {2, "two"}, {3, "three"}});
+    }
+
+    SECTION("unordered_set")
+    {
+        std::unordered_set<int> set;
+        Containers::add_items(set, std::views::iota(0, 1000));
+        CHECK(set.size() == 1000);
+        CHECK(set.contains(999));
+    }
+}
+
+TEST_CASE("add_items - benchmark", "[.][benchmark]")
+{
+    constexpr int n = 100'000;
+
+    std::vector<int> sorted_data(n);
+    std::iota(sorted_data.begin(), sorted_data.end(), 0);
+
+    std::vector<int> shuffled_data = sorted_data;
+    std::ranges::shuffle(shuffled_data, std::mt19937{665});
+
+    BENCHMARK("vector - push_back loop")
+    {
+        std::vector<int> vec;
+        for (int item : sorted_data)
+            vec.push_back(item);
+        return vec;
+    };
+
+    BENCHMARK("vector - insert(end, first, last)")
+    {
+        std::vector<int> vec;
+        vec.insert(vec.end(), sorted_data.begin(), sorted_data.end());
+        return vec;
+    };
+
+    BENCHMARK("vector - add_items (range insert)")
+    {
+        std::vector<int> vec;
+        Containers::add_items(vec, sorted_data);
+        return vec;
+    };
+
+    BENCHMARK("deque - push_back loop")
+    {
+        std::deque<int> dq;
+        for (int item : sorted_data)
+            dq.push_back(item);
+        return dq;
+    };
+
+    BENCHMARK("deque - add_items (range insert)")
+    {
+        std::deque<int> dq;
+        Containers::add_items(dq, sorted_data);
+        return dq;
+    };
+
+    BENCHMARK("set - insert loop (sorted input)")
+    {
+        std::set<int> set;
+        for (int item : sorted_data)
+            set.insert(item);
+        return set;
+    };
+
+    BENCHMARK("set - add_items (sorted input, hinted)")
+    {
+        std::set<int> set;
+        Containers::add_items(set, sorted_data);
+        return set;
+    };
+
+    BENCHMARK("set - add_items (shuffled input)")
+    {
+        std::set<int> set;
+        Containers::add_items(set, shuffled_data);
+        return set;
+    };
+
+    BENCHMARK("unordered_set - insert loop")
+    {
+        std::unordered_set<int> set;
+        for (int item : shuffled_data)
+            set.insert(item);
+        return set;
+    };
+
+    BENCHMARK("unordered_set - add_items (reserved)")
+    {
+        std::unordered_set<int> set;
+        Containers::add_items(set, shuffled_data);
+        return set;
+    };
+}
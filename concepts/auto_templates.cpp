@@ -1,3 +1,5 @@
+#include "call_tracing.hpp"
+
 #include <catch2/catch_test_macros.hpp>
 #include <iostream>
 #include <map>
@@ -95,23 +97,18 @@ TEST_CASE("abbreviated template functions")
 template <typename F, typename... TArgs>
 decltype(auto) call_wrapper(F f, TArgs&&... args)
 {
-    std::cout << "calling a function!!!" << std::endl;
-
-    return f(std::forward<TArgs>(args)...); // perfect forwarding
+    return Tracing::traced_call("call_wrapper", f, std::forward<TArgs>(args)...); // perfect forwarding
 }
 
 namespace Cpp20
 {
     decltype(auto) call_wrapper(auto f, auto&&... args)
     {
-        std::cout << "calling a function!!!" << std::endl;
-
-        return f(std::forward<decltype(args)>(args)...); // perfect forwarding
+        return Tracing::traced_call("Cpp20::call_wrapper", f, std::forward<decltype(args)>(args)...); // perfect forwarding
     }
 
     const static inline auto caller = []<typename... TArgs>(auto f, TArgs&&... args) {
-        std::cout << "calling a function!!!" << std::endl;
-        return f(std::forward<TArgs>(args)...);
+        return Tracing::traced_call("Cpp20::caller", f, std::forward<TArgs>(args)...);
     };
 } // namespace Cpp20
 
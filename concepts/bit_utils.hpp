@@ -0,0 +1,188 @@
+#ifndef BIT_UTILS_HPP
+#define BIT_UTILS_HPP
+
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+/////////////////////////////////////////////////////////////////////////////////
+// Power-of-two utilities for integers & IEEE floats - scalar & batched over spans
+//
+// is_power_of_2(x) - x is an exact power of two (2^k, also negative k for floats)
+// log2(x)          - floor(log2(x)) for x > 0 (log2(0) == -1 for integers)
+// bit_ceil(x)      - smallest power of two >= x
+// next_pow2(x)     - smallest power of two > x (0 for integers if not representable)
+//
+// The floating point path reads exponent & mantissa fields directly (no std::frexp).
+// All functions are branch-free, so batch loops over spans are vectorized by the compiler.
+// With GCC on x86-64 Linux batch kernels are compiled for several ISAs and the best one
+// is selected at load time (target_clones + ifunc).
+
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__)
+#define BITS_SIMD_KERNEL [[gnu::target_clones("arch=x86-64-v4", "avx2", "default")]]
+#else
+#define BITS_SIMD_KERNEL
+#endif
+
+namespace Bits
+{
+    template <typename T>
+    concept IeeeFloatingPoint = std::floating_point<T> && std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8);
+
+    template <typename T>
+    concept Integer = std::integral<T> && !std::same_as<T, bool>;
+
+    template <typename T>
+    concept BitOperand = Integer<T> || IeeeFloatingPoint<T>;
+
+    namespace Detail
+    {
+        template <IeeeFloatingPoint T>
+        struct FloatBits
+        {
+            using UInt = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+
+            static constexpr int mantissa_bits = std::numeric_limits<T>::digits - 1;
+            static constexpr int bias = std::numeric_limits<T>::max_exponent - 1;
+            static constexpr UInt mantissa_mask = (UInt{1} << mantissa_bits) - 1;
+            static constexpr UInt exponent_max = (UInt{1} << (sizeof(T) * 8 - 1 - mantissa_bits)) - 1; // inf & NaN
+
+            UInt sign;
+            UInt exponent; // biased
+            UInt mantissa;
+
+            constexpr explicit FloatBits(T value)
+            {
+                const auto bits = std::bit_cast<UInt>(value);
+                sign = bits >> (sizeof(T) * 8 - 1);
+                exponent = (bits >> mantissa_bits) & exponent_max;
+                mantissa = bits & mantissa_mask;
+            }
+
+            // 2^e for e in [min subnormal exponent, max exponent + 1] - the upper bound gives +inf
+            static constexpr T pow2(int e)
+            {
+                const int biased = e + bias;
+                const UInt normal = static_cast<UInt>(biased > 0 ? biased : 0) << mantissa_bits;
+                const UInt subnormal = UInt{1} << ((biased + mantissa_bits - 1) & (sizeof(T) * 8 - 1));
+                return std::bit_cast<T>(biased > 0 ? normal : subnormal);
+            }
+        };
+    } // namespace Detail
+
+    ///////////////////////////
+    // integers
+
+    template <Integer T>
+    constexpr bool is_power_of_2(T value)
+    {
+        const auto x = static_cast<std::make_unsigned_t<T>>(value);
+        return (value > 0) & ((x & (x - 1)) == 0);
+    }
+
+    template <Integer T>
+    constexpr int log2(T value)
+    {
+        return std::bit_width(static_cast<std::make_unsigned_t<T>>(value)) - 1;
+    }
+
+    // value must be >= 0 and the result must be representable in T
+    template <Integer T>
+    constexpr T bit_ceil(T value)
+    {
+        using UInt = std::make_unsigned_t<T>;
+        const auto x = static_cast<UInt>(value);
+        return static_cast<T>(x <= 1 ? UInt{1} : static_cast<UInt>(UInt{1} << std::bit_width(static_cast<UInt>(x - 1))));
+    }
+
+    // 0 if the result is not representable in T (value < 0 or value >= the largest power of two of T)
+    template <Integer T>
+    constexpr T next_pow2(T value)
+    {
+        using UInt = std::make_unsigned_t<T>;
+        const int shift = std::bit_width(static_cast<UInt>(value));
+        const auto result = static_cast<UInt>(UInt{1} << (shift % std::numeric_limits<UInt>::digits)); // no shift by the full width
+        return shift < std::numeric_limits<T>::digits ? static_cast<T>(result) : T{0};
+    }
+
+    ///////////////////////////
+    // IEEE floating point
+
+    template <IeeeFloatingPoint T>
+    constexpr bool is_power_of_2(T value)
+    {
+        using Fields = Detail::FloatBits<T>;
+        const Fields bits{value};
+
+        const bool normal = (bits.exponent - 1 < Fields::exponent_max - 1) & (bits.mantissa == 0);
+        const bool subnormal = (bits.exponent == 0) & is_power_of_2(bits.mantissa);
+        return (bits.sign == 0) & (normal | subnormal);
+    }
+
+    // value must be finite & > 0
+    template <IeeeFloatingPoint T>
+    constexpr int log2(T value)
+    {
+        using Fields = Detail::FloatBits<T>;
+        const Fields bits{value};
+
+        const int normal = static_cast<int>(bits.exponent) - Fields::bias;
+        const int subnormal = log2(bits.mantissa) + 1 - Fields::bias - Fields::mantissa_bits;
+        return bits.exponent != 0 ? normal : subnormal;
+    }
+
+    // value must be finite & > 0 - overflows to +inf
+    template <IeeeFloatingPoint T>
+    constexpr T bit_ceil(T value)
+    {
+        return is_power_of_2(value) ? value : Detail::FloatBits<T>::pow2(log2(value) + 1);
+    }
+
+    template <IeeeFloatingPoint T>
+    constexpr T next_pow2(T value)
+    {
+        return Detail::FloatBits<T>::pow2(log2(value) + 1);
+    }
+
+    ///////////////////////////
+    // batch kernels - results.size() must be >= values.size()
+
+    template <BitOperand T>
+    BITS_SIMD_KERNEL void is_power_of_2(std::span<const T> values, std::span<bool> results)
+    {
+        assert(results.size() >= values.size());
+        for (size_t i = 0; i < values.size(); ++i)
+            results[i] = is_power_of_2(values[i]);
+    }
+
+    template <BitOperand T>
+    BITS_SIMD_KERNEL void log2(std::span<const T> values, std::span<int> results)
+    {
+        assert(results.size() >= values.size());
+        for (size_t i = 0; i < values.size(); ++i)
+            results[i] = log2(values[i]);
+    }
+
+    template <BitOperand T>
+    BITS_SIMD_KERNEL void bit_ceil(std::span<const T> values, std::span<T> results)
+    {
+        assert(results.size() >= values.size());
+        for (size_t i = 0; i < values.size(); ++i)
+            results[i] = bit_ceil(values[i]);
+    }
+
+    template <BitOperand T>
+    BITS_SIMD_KERNEL void next_pow2(std::span<const T> values, std::span<T> results)
+    {
+        assert(results.size() >= values.size());
+        for (size_t i = 0; i < values.size(); ++i)
+            results[i] = next_pow2(values[i]);
+    }
+} // namespace Bits
+
+#endif
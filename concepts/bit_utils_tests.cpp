@@ -0,0 +1,173 @@
+#include "bit_utils.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    template <typename T>
+    bool is_power_of_2_frexp(T value)
+    {
+        int exponent;
+        return value > 0 && std::frexp(value, &exponent) == static_cast<T>(0.5);
+    }
+} // namespace
+
+TEST_CASE("Bits - integers")
+{
+    static_assert(Bits::is_power_of_2(1));
+    static_assert(Bits::is_power_of_2(64u));
+    static_assert(!Bits::is_power_of_2(0));
+    static_assert(!Bits::is_power_of_2(-8));
+    static_assert(!Bits::is_power_of_2(std::numeric_limits<int>::min()));
+    static_assert(Bits::is_power_of_2(uint64_t{1} << 63));
+
+    static_assert(Bits::log2(1) == 0);
+    static_assert(Bits::log2(1023u) == 9);
+    static_assert(Bits::log2(1024u) == 10);
+    static_assert(Bits::log2(0) == -1);
+
+    static_assert(Bits::bit_ceil(0) == 1);
+    static_assert(Bits::bit_ceil(17) == 32);
+    static_assert(Bits::bit_ceil(32) == 32);
+    static_assert(Bits::next_pow2(0) == 1);
+    static_assert(Bits::next_pow2(32) == 64);
+    static_assert(Bits::next_pow2(int8_t{63}) == 64);
+
+    // result not representable - 0
+    static_assert(Bits::next_pow2(int8_t{64}) == 0);
+    static_assert(Bits::next_pow2(-5) == 0);
+    static_assert(Bits::next_pow2(uint8_t{255}) == 0);
+    static_assert(Bits::next_pow2(uint32_t{1} << 31) == 0);
+    static_assert(Bits::next_pow2(std::numeric_limits<uint64_t>::max()) == 0);
+    static_assert(Bits::next_pow2((uint64_t{1} << 63) - 1) == uint64_t{1} << 63);
+
+    for (uint32_t x = 1; x < 100'000; ++x)
+    {
+        REQUIRE(Bits::bit_ceil(x) == std::bit_ceil(x));
+        REQUIRE(Bits::log2(x) == static_cast<int>(std::bit_width(x)) - 1); // bit_width returns T before LWG 3656
+        REQUIRE(Bits::is_power_of_2(x) == std::has_single_bit(x));
+    }
+}
+
+TEST_CASE("Bits - IEEE floating point")
+{
+    static_assert(Bits::is_power_of_2(8.0));
+    static_assert(Bits::is_power_of_2(0.25f));
+    static_assert(!Bits::is_power_of_2(3.0));
+    static_assert(!Bits::is_power_of_2(-4.0));
+    static_assert(!Bits::is_power_of_2(0.0));
+    static_assert(!Bits::is_power_of_2(-0.0));
+    static_assert(!Bits::is_power_of_2(std::numeric_limits<double>::infinity()));
+    static_assert(!Bits::is_power_of_2(std::numeric_limits<double>::quiet_NaN()));
+    static_assert(Bits::is_power_of_2(std::numeric_limits<float>::denorm_min()));
+    static_assert(Bits::is_power_of_2(std::numeric_limits<double>::min()));
+
+    static_assert(Bits::log2(1.0) == 0);
+    static_assert(Bits::log2(0.75) == -1);
+    static_assert(Bits::log2(1000.0f) == 9);
+    static_assert(Bits::log2(std::numeric_limits<float>::denorm_min()) == -149);
+    static_assert(Bits::log2(std::numeric_limits<double>::denorm_min()) == -1074);
+
+    static_assert(Bits::bit_ceil(3.0) == 4.0);
+    static_assert(Bits::bit_ceil(4.0) == 4.0);
+    static_assert(Bits::bit_ceil(0.3f) == 0.5f);
+    static_assert(Bits::next_pow2(4.0) == 8.0);
+    static_assert(Bits::next_pow2(std::numeric_limits<float>::denorm_min()) == 2 * std::numeric_limits<float>::denorm_min());
+    static_assert(Bits::bit_ceil(std::numeric_limits<float>::max()) == std::numeric_limits<float>::infinity());
+
+    SECTION("same results as std::frexp")
+    {
+        std::mt19937 rnd_gen{665};
+        std::uniform_int_distribution<int> exponent_distr(-1070, 1020);
+        std::uniform_int_distribution<int> mantissa_distr(1, 8);
+
+        for (int i = 0; i < 100'000; ++i)
+        {
+            const double value = std::ldexp(mantissa_distr(rnd_gen), exponent_distr(rnd_gen));
+
+            REQUIRE(Bits::is_power_of_2(value) == is_power_of_2_frexp(value));
+            REQUIRE(Bits::log2(value) == static_cast<int>(std::floor(std::log2(value))));
+            REQUIRE(Bits::bit_ceil(value) == std::exp2(std::ceil(std::log2(value))));
+        }
+    }
+}
+
+TEST_CASE("Bits - batch kernels")
+{
+    SECTION("allocator size classes")
+    {
+        const std::vector<uint32_t> requested_sizes = {1, 8, 9, 24, 64, 100, 4096, 4097};
+
+        std::vector<uint32_t> block_sizes(requested_sizes.size());
+        Bits::bit_ceil(std::span<const uint32_t>{requested_sizes}, std::span<uint32_t>{block_sizes});
+
+        std::vector<int> size_classes(requested_sizes.size());
+        Bits::log2(std::span<const uint32_t>{block_sizes}, std::span<int>{size_classes});
+
+        CHECK(block_sizes == std::vector<uint32_t>{1, 8, 16, 32, 64, 128, 4096, 8192});
+        CHECK(size_classes == std::vector{0, 3, 4, 5, 6, 7, 12, 13});
+    }
+
+    SECTION("floating point")
+    {
+        const std::vector<float> values = {0.5f, 0.7f, 1.0f, 3.0f, 1024.0f};
+
+        bool is_pow2[5];
+        Bits::is_power_of_2(std::span<const float>{values}, std::span<bool>{is_pow2});
+        CHECK(std::ranges::equal(is_pow2, std::vector{true, false, true, false, true}));
+
+        std::vector<float> next(values.size());
+        Bits::next_pow2(std::span<const float>{values}, std::span<float>{next});
+        CHECK(next == std::vector{1.0f, 1.0f, 2.0f, 4.0f, 2048.0f});
+    }
+}
+
+TEST_CASE("Bits - benchmark", "[.][benchmark]")
+{
+    std::mt19937 rnd_gen{665};
+    std::uniform_real_distribution<double> distr(0.0, 1'000.0);
+
+    std::vector<double> values(100'000);
+    std::ranges::generate(values, [&] { return std::round(distr(rnd_gen)); });
+    const auto results = std::make_unique<bool[]>(values.size()); // std::vector<bool> is bit-packed - no std::span<bool>
+
+    BENCHMARK("is_power_of_2 - std::frexp")
+    {
+        for (size_t i = 0; i < values.size(); ++i)
+            results[i] = is_power_of_2_frexp(values[i]);
+        return results[0];
+    };
+
+    BENCHMARK("is_power_of_2 - IEEE bits batch")
+    {
+        Bits::is_power_of_2(std::span<const double>{values}, std::span<bool>{results.get(), values.size()});
+        return results[0];
+    };
+
+    std::vector<uint64_t> sizes(100'000);
+    std::ranges::generate(sizes, [&] { return static_cast<uint64_t>(distr(rnd_gen) * 1'000) + 1; });
+    std::vector<uint64_t> block_sizes(sizes.size());
+
+    BENCHMARK("bit_ceil - std::bit_ceil loop")
+    {
+        std::ranges::transform(sizes, block_sizes.begin(), [](uint64_t size) { return std::bit_ceil(size); });
+        return block_sizes[0];
+    };
+
+    BENCHMARK("bit_ceil - batch")
+    {
+        Bits::bit_ceil(std::span<const uint64_t>{sizes}, std::span<uint64_t>{block_sizes});
+        return block_sizes[0];
+    };
+}
@@ -0,0 +1,320 @@
+#ifndef CALL_TRACING_HPP
+#define CALL_TRACING_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define CALL_TRACING_RDTSC 1
+#else
+#define CALL_TRACING_RDTSC 0
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////
+// Call tracing for hot paths
+//
+// return Tracing::traced_call("parse", parse, text); // records start/end timestamps & size of arguments
+//
+// Compile with -DCALL_TRACING_ENABLED=1 to record calls - by default traced_call is a plain call
+// (no timestamps, no stores). A single call site can be forced on/off with traced_call<true/false>(...).
+//
+// Every thread writes into its own ring buffer (single writer, no locks, no allocations after the first
+// call) - the oldest events are overwritten. write_chrome_trace() dumps events as Chrome trace JSON
+// (chrome://tracing, ui.perfetto.dev) - call it (and clear()) when traced threads are quiescent.
+//
+// A buffer takes CALL_TRACING_BUFFER_CAPACITY * 32 B (512 KiB by default) per traced thread. Buffers of
+// exited threads are kept until their events are exported by write_chrome_trace() or dropped by clear() -
+// with thread pool churn call one of them periodically.
+
+#ifndef CALL_TRACING_ENABLED
+#define CALL_TRACING_ENABLED 0
+#endif
+
+#ifndef CALL_TRACING_BUFFER_CAPACITY
+#define CALL_TRACING_BUFFER_CAPACITY (1 << 14)
+#endif
+
+namespace Tracing
+{
+    inline constexpr bool tracing_enabled = CALL_TRACING_ENABLED;
+
+    struct TraceEvent
+    {
+        const char* name; // string literal
+        uint64_t start_ticks;
+        uint64_t end_ticks;
+        uint32_t args_size;
+    };
+
+    namespace Detail
+    {
+        inline uint64_t now_ticks()
+        {
+#if CALL_TRACING_RDTSC
+            return __rdtsc();
+#else
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+        }
+
+        inline void write_json_string(std::ostream& out, std::string_view text)
+        {
+            constexpr std::string_view hex_digits = "0123456789abcdef";
+
+            out << '"';
+            for (const char c : text)
+            {
+                if (c == '"' || c == '\\')
+                    out << '\\' << c;
+                else if (static_cast<unsigned char>(c) < 0x20)
+                    out << "\\u00" << hex_digits[(c >> 4) & 0xF] << hex_digits[c & 0xF];
+                else
+                    out << c;
+            }
+            out << '"';
+        }
+    } // namespace Detail
+
+    class ThreadTraceBuffer
+    {
+    public:
+        static constexpr size_t capacity = CALL_TRACING_BUFFER_CAPACITY;
+        static_assert(capacity > 0);
+
+    private:
+        std::unique_ptr<TraceEvent[]> events_ = std::make_unique<TraceEvent[]>(capacity);
+        std::atomic<uint64_t> recorded_{0};
+        std::atomic<bool> retired_{false};
+        uint32_t thread_id_;
+
+    public:
+        explicit ThreadTraceBuffer(uint32_t thread_id)
+            : thread_id_{thread_id}
+        {
+        }
+
+        // called only by the owning thread
+        void push(const TraceEvent& event)
+        {
+            const uint64_t index = recorded_.load(std::memory_order_relaxed);
+            events_[index % capacity] = event;
+            recorded_.store(index + 1, std::memory_order_release);
+        }
+
+        uint32_t thread_id() const
+        {
+            return thread_id_;
+        }
+
+        // number of all recorded calls - including overwritten ones
+        uint64_t calls() const
+        {
+            return recorded_.load(std::memory_order_acquire);
+        }
+
+        // visits events still stored in the buffer - from the oldest one
+        template <typename F>
+        void for_each(F f) const
+        {
+            const uint64_t recorded = calls();
+            const uint64_t first = recorded > capacity ? recorded - capacity : 0;
+            for (uint64_t i = first; i < recorded; ++i)
+                f(events_[i % capacity]);
+        }
+
+        // not synchronized with push() - only when the owning thread is quiescent
+        void clear()
+        {
+            recorded_.store(0, std::memory_order_release);
+        }
+
+        // the owning thread has exited - no more events will be pushed
+        void retire()
+        {
+            retired_.store(true, std::memory_order_release);
+        }
+
+        bool is_retired() const
+        {
+            return retired_.load(std::memory_order_acquire);
+        }
+    };
+
+    class TraceRegistry
+    {
+        std::mutex mtx_;
+        std::vector<std::shared_ptr<ThreadTraceBuffer>> buffers_; // buffers outlive their threads until exported
+        uint32_t next_thread_id_ = 1;
+
+        const uint64_t start_ticks_ = Detail::now_ticks();
+        const std::chrono::steady_clock::time_point start_time_ = std::chrono::steady_clock::now();
+
+        // marks the buffer as retired when its thread exits
+        struct ThreadBufferOwner
+        {
+            std::shared_ptr<ThreadTraceBuffer> buffer;
+
+            ~ThreadBufferOwner()
+            {
+                buffer->retire();
+            }
+        };
+
+        std::shared_ptr<ThreadTraceBuffer> register_thread()
+        {
+            std::lock_guard lk{mtx_};
+            return buffers_.emplace_back(std::make_shared<ThreadTraceBuffer>(next_thread_id_++));
+        }
+
+        // rdtsc ticks are converted using the ratio measured since the registry was created
+        double ticks_per_microsecond()
+        {
+#if CALL_TRACING_RDTSC
+            const auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time_).count();
+            const auto ticks = static_cast<double>(Detail::now_ticks() - start_ticks_);
+            return elapsed > 0 && ticks > 0 ? ticks / elapsed : 1.0;
+#else
+            return 1'000.0;
+#endif
+        }
+
+    public:
+        static TraceRegistry& instance()
+        {
+            static TraceRegistry registry;
+            return registry;
+        }
+
+        ThreadTraceBuffer& local_buffer()
+        {
+            thread_local const ThreadBufferOwner owner{register_thread()};
+            return *owner.buffer;
+        }
+
+        // number of registered buffers - live threads & exited threads whose events were not exported yet
+        size_t buffers_count()
+        {
+            std::lock_guard lk{mtx_};
+            return buffers_.size();
+        }
+
+        template <typename F>
+        void for_each_buffer(F f)
+        {
+            std::lock_guard lk{mtx_};
+            for (const auto& buffer : buffers_)
+                f(std::as_const(*buffer));
+        }
+
+        // traced threads must be quiescent - a reset racing with push() may be lost;
+        // buffers of exited threads are released
+        void clear()
+        {
+            std::lock_guard lk{mtx_};
+            std::erase_if(buffers_, [](const auto& buffer) { return buffer->is_retired(); });
+            for (const auto& buffer : buffers_)
+                buffer->clear();
+        }
+
+        // number of events per traced name still stored in buffers - overwritten events are not counted,
+        // calls() of buffers is the number of all recorded calls
+        std::map<std::string_view, uint64_t> retained_event_counts()
+        {
+            std::map<std::string_view, uint64_t> counts;
+            for_each_buffer([&](const ThreadTraceBuffer& buffer) {
+                buffer.for_each([&](const TraceEvent& event) { ++counts[event.name]; });
+            });
+            return counts;
+        }
+
+        // buffers of exited threads are released once their events are written
+        void write_chrome_trace(std::ostream& out)
+        {
+            const double ticks_per_us = ticks_per_microsecond();
+            const auto to_us = [&](uint64_t ticks) { return static_cast<double>(ticks) / ticks_per_us; };
+
+            uint64_t dropped = 0;
+            bool first = true;
+            std::vector<const ThreadTraceBuffer*> exported_retired; // retired before export - all events are written
+
+            out << "{\"traceEvents\":[";
+            for_each_buffer([&](const ThreadTraceBuffer& buffer) {
+                if (buffer.is_retired())
+                    exported_retired.push_back(&buffer);
+
+                if (buffer.calls() > ThreadTraceBuffer::capacity)
+                    dropped += buffer.calls() - ThreadTraceBuffer::capacity;
+
+                buffer.for_each([&](const TraceEvent& event) {
+                    out << (first ? "\n" : ",\n") << "{\"name\":";
+                    Detail::write_json_string(out, event.name);
+                    out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer.thread_id()
+                        << ",\"ts\":" << to_us(event.start_ticks - start_ticks_)
+                        << ",\"dur\":" << to_us(event.end_ticks - event.start_ticks)
+                        << ",\"args\":{\"args_size\":" << event.args_size << "}}";
+                    first = false;
+                });
+            });
+            out << "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped_events\":" << dropped << "}}\n";
+
+            std::lock_guard lk{mtx_};
+            std::erase_if(buffers_, [&](const auto& buffer) { return std::ranges::find(exported_retired, buffer.get()) != exported_retired.end(); });
+        }
+    };
+
+    // records a complete event when the traced call returns (or throws)
+    class ScopedTrace
+    {
+        ThreadTraceBuffer& buffer_;
+        const char* name_;
+        uint32_t args_size_;
+        uint64_t start_ticks_;
+
+    public:
+        // registry is created before the clock is read - timestamps are never earlier than the start of the trace
+        ScopedTrace(const char* name, uint32_t args_size)
+            : buffer_{TraceRegistry::instance().local_buffer()}
+            , name_{name}
+            , args_size_{args_size}
+            , start_ticks_{Detail::now_ticks()}
+        {
+        }
+
+        ScopedTrace(const ScopedTrace&) = delete;
+        ScopedTrace& operator=(const ScopedTrace&) = delete;
+
+        ~ScopedTrace()
+        {
+            const uint64_t end_ticks = Detail::now_ticks();
+            buffer_.push(TraceEvent{name_, start_ticks_, end_ticks, args_size_});
+        }
+    };
+
+    template <bool Enabled = tracing_enabled, typename F, typename... TArgs>
+    decltype(auto) traced_call(const char* name, F&& f, TArgs&&... args)
+    {
+        if constexpr (Enabled)
+        {
+            constexpr auto args_size = static_cast<uint32_t>((0 + ... + sizeof(std::remove_cvref_t<TArgs>)));
+            const ScopedTrace trace{name, args_size};
+            return std::invoke(std::forward<F>(f), std::forward<TArgs>(args)...);
+        }
+        else
+            return std::invoke(std::forward<F>(f), std::forward<TArgs>(args)...);
+    }
+} // namespace Tracing
+
+#endif
@@ -0,0 +1,235 @@
+#include "call_tracing.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    int square(int x)
+    {
+        return x * x;
+    }
+
+    std::vector<Tracing::TraceEvent> recorded_events()
+    {
+        std::vector<Tracing::TraceEvent> events;
+        Tracing::TraceRegistry::instance().for_each_buffer([&](const Tracing::ThreadTraceBuffer& buffer) {
+            buffer.for_each([&](const Tracing::TraceEvent& event) { events.push_back(event); });
+        });
+        return events;
+    }
+} // namespace
+
+// first traced call in the program - the registry is created by traced_call itself
+TEST_CASE("write_chrome_trace - registry created by the first traced call")
+{
+    Tracing::traced_call<true>("first", square, 1);
+
+    std::ostringstream out;
+    Tracing::TraceRegistry::instance().write_chrome_trace(out);
+    const std::string json = out.str();
+
+    const auto ts_pos = json.find("\"ts\":");
+    REQUIRE(ts_pos != std::string::npos);
+    const double ts = std::stod(json.substr(ts_pos + 5));
+    CHECK(ts >= 0.0);
+    CHECK(ts < 60'000'000.0); // no wrap-around of start_ticks - less than a minute since the start of the trace
+}
+
+TEST_CASE("traced_call")
+{
+    auto& registry = Tracing::TraceRegistry::instance();
+    registry.clear();
+
+    SECTION("disabled - plain call")
+    {
+        CHECK(Tracing::traced_call<false>("square", square, 4) == 16);
+        CHECK(recorded_events().empty());
+    }
+
+    SECTION("enabled - records an event per call")
+    {
+        CHECK(Tracing::traced_call<true>("square", square, 4) == 16);
+        CHECK(Tracing::traced_call<true>("square", square, 5) == 25);
+        CHECK(Tracing::traced_call<true>("concat", [](const std::string& a, const std::string& b) { return a + b; }, "ab"s, "cd"s) == "abcd");
+
+        const auto events = recorded_events();
+        REQUIRE(events.size() == 3);
+        CHECK(events[0].name == "square"sv);
+        CHECK(events[0].args_size == sizeof(int));
+        CHECK(events[0].start_ticks <= events[0].end_ticks);
+        CHECK(events[2].args_size == 2 * sizeof(std::string));
+
+        const auto counts = registry.retained_event_counts();
+        CHECK(counts.at("square") == 2);
+        CHECK(counts.at("concat") == 1);
+    }
+
+    SECTION("returned references are forwarded")
+    {
+        int value = 1;
+        int& ref = Tracing::traced_call<true>("identity", [](int& x) -> int& { return x; }, value);
+        CHECK(&ref == &value);
+    }
+
+    SECTION("nested calls - inner call ends first")
+    {
+        Tracing::traced_call<true>("outer", [] { return Tracing::traced_call<true>("inner", square, 3); });
+
+        const auto events = recorded_events();
+        REQUIRE(events.size() == 2);
+        CHECK(events[0].name == "inner"sv);
+        CHECK(events[1].name == "outer"sv);
+        CHECK(events[1].start_ticks <= events[0].start_ticks);
+        CHECK(events[0].end_ticks <= events[1].end_ticks);
+    }
+
+    SECTION("call that throws is recorded")
+    {
+        CHECK_THROWS_AS(Tracing::traced_call<true>("throwing", [] { throw std::runtime_error{"error"}; }), std::runtime_error);
+        CHECK(registry.retained_event_counts().at("throwing") == 1);
+    }
+}
+
+TEST_CASE("ThreadTraceBuffer")
+{
+    Tracing::ThreadTraceBuffer buffer{42};
+
+    const uint64_t count = Tracing::ThreadTraceBuffer::capacity + 10;
+    for (uint64_t i = 0; i < count; ++i)
+        buffer.push(Tracing::TraceEvent{"event", i, i + 1, 0});
+
+    CHECK(buffer.calls() == count);
+
+    std::vector<uint64_t> starts;
+    buffer.for_each([&](const Tracing::TraceEvent& event) { starts.push_back(event.start_ticks); });
+    REQUIRE(starts.size() == Tracing::ThreadTraceBuffer::capacity);
+    CHECK(starts.front() == 10); // the oldest events are overwritten
+    CHECK(starts.back() == count - 1);
+
+    buffer.clear();
+    CHECK(buffer.calls() == 0);
+}
+
+TEST_CASE("traced_call - many threads")
+{
+    auto& registry = Tracing::TraceRegistry::instance();
+    registry.clear();
+
+    constexpr int threads_count = 4;
+    constexpr int calls_per_thread = static_cast<int>(std::min<size_t>(1'000, Tracing::ThreadTraceBuffer::capacity)); // none overwritten
+
+    std::vector<std::jthread> threads;
+    for (int t = 0; t < threads_count; ++t)
+        threads.emplace_back([] {
+            for (int i = 0; i < calls_per_thread; ++i)
+                Tracing::traced_call<true>("worker", square, i);
+        });
+    threads.clear(); // join
+
+    CHECK(registry.retained_event_counts().at("worker") == threads_count * calls_per_thread);
+
+    size_t buffers_with_events = 0;
+    registry.for_each_buffer([&](const Tracing::ThreadTraceBuffer& buffer) {
+        if (buffer.calls() > 0)
+        {
+            ++buffers_with_events;
+            CHECK(buffer.calls() == calls_per_thread);
+        }
+    });
+    CHECK(buffers_with_events == threads_count);
+}
+
+TEST_CASE("traced_call - buffers of exited threads are released")
+{
+    auto& registry = Tracing::TraceRegistry::instance();
+    registry.clear();
+    const size_t live_buffers = registry.buffers_count();
+
+    auto trace_in_thread = [] { std::jthread{[] { Tracing::traced_call<true>("pooled", square, 3); }}; };
+
+    trace_in_thread();
+    trace_in_thread();
+    CHECK(registry.buffers_count() == live_buffers + 2); // not exported yet
+
+    std::ostringstream out;
+    registry.write_chrome_trace(out);
+    CHECK(out.str().find("\"name\":\"pooled\"") != std::string::npos);
+    CHECK(registry.buffers_count() == live_buffers);
+
+    trace_in_thread();
+    registry.clear();
+    CHECK(registry.buffers_count() == live_buffers);
+}
+
+TEST_CASE("write_chrome_trace")
+{
+    auto& registry = Tracing::TraceRegistry::instance();
+    registry.clear();
+
+    Tracing::traced_call<true>("square", square, 2);
+    Tracing::traced_call<true>("say \"hello\"", [] { return 0; });
+
+    std::ostringstream out;
+    registry.write_chrome_trace(out);
+    const std::string json = out.str();
+
+    CHECK(json.starts_with("{\"traceEvents\":["));
+    CHECK(json.find("{\"name\":\"square\",\"ph\":\"X\",\"pid\":1,\"tid\":") != std::string::npos);
+    CHECK(json.find("\"name\":\"say \\\"hello\\\"\"") != std::string::npos);
+    CHECK(json.find("\"args\":{\"args_size\":4}") != std::string::npos);
+    CHECK(json.find("\"dropped_events\":0") != std::string::npos);
+}
+
+TEST_CASE("traced_call - benchmark", "[.][benchmark]")
+{
+    std::vector<int> args(1'000);
+    for (size_t i = 0; i < args.size(); ++i)
+        args[i] = static_cast<int>(i);
+
+    std::ostringstream log;
+
+    BENCHMARK("plain call")
+    {
+        int result = 0;
+        for (int arg : args)
+            result += square(arg);
+        return result;
+    };
+
+    BENCHMARK("logging with std::endl")
+    {
+        int result = 0;
+        for (int arg : args)
+        {
+            log << "calling a function!!!" << std::endl;
+            result += square(arg);
+        }
+        log.str("");
+        return result;
+    };
+
+    BENCHMARK("traced_call<false>")
+    {
+        int result = 0;
+        for (int arg : args)
+            result += Tracing::traced_call<false>("square", square, arg);
+        return result;
+    };
+
+    BENCHMARK("traced_call<true>")
+    {
+        int result = 0;
+        for (int arg : args)
+            result += Tracing::traced_call<true>("square", square, arg);
+        return result;
+    };
+}
@@ -1,9 +1,12 @@
+#include <array>
 #include <catch2/catch_test_macros.hpp>
 #include <cmath>
 #include <iostream>
 #include <map>
 #include <numeric>
+#include <ranges>
 #include <set>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -93,12 +96,38 @@ struct IsContigues<T[N]>
     static constexpr bool value = true;
 };
 
+template <typename T, size_t N>
+struct IsContigues<std::array<T, N>>
+{
+    static constexpr bool value = true;
+};
+
+template <typename T, size_t Extent>
+struct IsContigues<std::span<T, Extent>>
+{
+    static constexpr bool value = true;
+};
+
+template <typename TChar, typename TTraits, typename TAllocator>
+struct IsContigues<std::basic_string<TChar, TTraits, TAllocator>>
+{
+    static constexpr bool value = true;
+};
+
 template <typename T>
 constexpr bool IsContigues_v = IsContigues<T>::value;
 
 static_assert(IsContigues_v<std::vector<int>>);
 static_assert(IsContigues_v<std::map<int, int>> == false);
 static_assert(IsContigues_v<int[10]>);
+static_assert(IsContigues_v<std::array<int, 10>>);
+static_assert(IsContigues_v<std::span<const int>>);
+static_assert(IsContigues_v<std::string>);
+
+// since C++20 the same information comes from std::ranges::contiguous_range
+// - see contiguous_algorithms.hpp for algorithms lowered to memcpy/memcmp/memchr
+static_assert(std::ranges::contiguous_range<std::vector<int>> && std::ranges::contiguous_range<int[10]>);
+static_assert(!std::ranges::contiguous_range<std::map<int, int>>);
 
 ////////////////////////////////////////////////
 
@@ -294,11 +323,13 @@ bool is_power_of_2(std::integral auto value)
     return value > 0 && (value & (value - 1)) == 0;
 }
 
-auto is_power_of_2(std::floating_point auto value)
+bool is_power_of_2(std::floating_point auto value)
 {
+    using TValue = decltype(value);
+
     int exponent;
-    const T mantissa = std::frexp(value, &exponent);
-    return mantissa == static_cast<T>(0.5);
+    const TValue mantissa = std::frexp(value, &exponent);
+    return mantissa == static_cast<TValue>(0.5);
 }
 
 namespace Cpp17
@@ -328,6 +359,9 @@ TEST_CASE("is_power_of_2")
     REQUIRE(is_power_of_2(77) == false);
 
     REQUIRE(is_power_of_2(8.0));
+    REQUIRE(is_power_of_2(0.25f));
+    REQUIRE(is_power_of_2(3.0) == false);
+    REQUIRE(is_power_of_2(0.75) == false);
 }
 
 //////////////////////////////////////////
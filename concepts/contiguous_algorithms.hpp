@@ -0,0 +1,243 @@
+#ifndef CONTIGUOUS_ALGORITHMS_HPP
+#define CONTIGUOUS_ALGORITHMS_HPP
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+/////////////////////////////////////////////////////////////////////////////////
+// Contiguity-aware algorithms
+//
+// copy, fill, equal, find & hash_range detect contiguous ranges (std::vector, std::array,
+// std::span, std::string, C arrays...) of trivially copyable elements and work on raw memory:
+//
+//   copy       -> memmove
+//   fill       -> memset (bytes or all-zero values)
+//   equal      -> memcmp (only for types where equal values have equal bytes - no floats, no padding)
+//   find       -> memchr for bytes, block-wise comparison loop (vectorized) for other scalars
+//   hash_range -> hashing of object representation in 4 independent lanes of 8-byte words
+//
+// Other ranges use plain iterator loops.
+
+namespace Algorithms
+{
+    template <typename TRange>
+    concept ContiguousTrivialRange = std::ranges::contiguous_range<TRange> && std::ranges::sized_range<TRange>
+        && std::is_trivially_copyable_v<std::ranges::range_value_t<TRange>>;
+
+    // ranges where value equality is equivalent to equality of bytes
+    template <typename TRange>
+    concept ContiguousBitwiseComparableRange = ContiguousTrivialRange<TRange>
+        && std::has_unique_object_representations_v<std::ranges::range_value_t<TRange>>;
+
+    template <typename TIterator, typename TValue>
+    concept ContiguousOutputIterator = std::contiguous_iterator<TIterator> && std::same_as<std::iter_value_t<TIterator>, TValue>
+        && !std::is_const_v<std::remove_reference_t<std::iter_reference_t<TIterator>>>;
+
+    namespace Detail
+    {
+        inline uint64_t mix64(uint64_t h)
+        {
+            h ^= h >> 33;
+            h *= 0xFF51AFD7ED558CCDull;
+            h ^= h >> 33;
+            h *= 0xC4CEB9FE1A85EC53ull;
+            h ^= h >> 33;
+            return h;
+        }
+
+        // 4 independent lanes of 8-byte words - lanes are combined & the tail is mixed in at the end
+        inline uint64_t hash_bytes(const std::byte* data, size_t size)
+        {
+            constexpr uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+
+            uint64_t lanes[4] = {size * multiplier, 1, 2, 3};
+            size_t offset = 0;
+            for (; offset + 32 <= size; offset += 32)
+            {
+                for (size_t lane = 0; lane < 4; ++lane)
+                {
+                    uint64_t word;
+                    std::memcpy(&word, data + offset + 8 * lane, 8);
+                    lanes[lane] = (lanes[lane] ^ word) * multiplier;
+                    lanes[lane] ^= lanes[lane] >> 29;
+                }
+            }
+
+            uint64_t h = mix64(lanes[0]) ^ mix64(lanes[1] + multiplier) ^ mix64(lanes[2] + 2 * multiplier) ^ mix64(lanes[3] + 3 * multiplier);
+            for (; offset < size; offset += 8)
+            {
+                uint64_t word = 0;
+                std::memcpy(&word, data + offset, std::min<size_t>(8, size - offset));
+                h = (h ^ mix64(word)) * multiplier;
+            }
+
+            return mix64(h);
+        }
+
+        // 256-byte blocks of comparisons without early exit are vectorized - the exact position is searched in a hit block
+        template <typename T>
+        const T* find_blocked(const T* first, const T* last, const T& value)
+        {
+            constexpr ptrdiff_t block_size = std::max<ptrdiff_t>(1, 256 / sizeof(T));
+
+            for (; last - first >= block_size; first += block_size)
+            {
+                unsigned found = 0;
+                for (ptrdiff_t i = 0; i < block_size; ++i)
+                    found |= (first[i] == value);
+                if (found)
+                    break;
+            }
+
+            for (; first != last; ++first)
+                if (*first == value)
+                    return first;
+            return last;
+        }
+
+        template <typename T>
+        bool all_bytes_zero(const T& value)
+        {
+            std::byte bytes[sizeof(T)];
+            std::memcpy(bytes, std::addressof(value), sizeof(T));
+            return std::ranges::all_of(bytes, [](std::byte b) { return b == std::byte{0}; });
+        }
+    } // namespace Detail
+
+    ///////////////////////////
+    // copy
+
+    template <std::ranges::input_range TRange, std::weakly_incrementable TOut>
+    TOut copy(TRange&& source, TOut out)
+    {
+        using TValue = std::ranges::range_value_t<TRange>;
+
+        if constexpr (ContiguousTrivialRange<TRange> && ContiguousOutputIterator<TOut, TValue>)
+        {
+            const size_t size = std::ranges::size(source);
+            if (size != 0)
+                std::memmove(std::to_address(out), std::ranges::data(source), size * sizeof(TValue));
+            return out + static_cast<std::iter_difference_t<TOut>>(size);
+        }
+        else
+            return std::ranges::copy(source, std::move(out)).out;
+    }
+
+    ///////////////////////////
+    // fill
+
+    template <std::ranges::forward_range TRange, typename T>
+        requires std::indirectly_writable<std::ranges::iterator_t<TRange>, const T&>
+    void fill(TRange&& range, const T& value)
+    {
+        using TValue = std::ranges::range_value_t<TRange>;
+
+        if constexpr (ContiguousTrivialRange<TRange> && std::is_scalar_v<TValue>)
+        {
+            const auto item = static_cast<TValue>(value);
+            const size_t size = std::ranges::size(range);
+
+            if constexpr (sizeof(TValue) == 1)
+                std::memset(std::ranges::data(range), std::bit_cast<unsigned char>(item), size);
+            else
+            {
+                if (Detail::all_bytes_zero(item))
+                    std::memset(std::ranges::data(range), 0, size * sizeof(TValue));
+                else
+                    std::fill_n(std::ranges::data(range), size, item);
+            }
+        }
+        else
+            std::ranges::fill(range, value);
+    }
+
+    ///////////////////////////
+    // equal
+
+    template <std::ranges::input_range TRange1, std::ranges::input_range TRange2>
+    bool equal(TRange1&& range1, TRange2&& range2)
+    {
+        using TValue1 = std::ranges::range_value_t<TRange1>;
+        using TValue2 = std::ranges::range_value_t<TRange2>;
+
+        if constexpr (ContiguousBitwiseComparableRange<TRange1> && ContiguousBitwiseComparableRange<TRange2> && std::same_as<TValue1, TValue2>)
+        {
+            const size_t size = std::ranges::size(range1);
+            return size == std::ranges::size(range2)
+                && (size == 0 || std::memcmp(std::ranges::data(range1), std::ranges::data(range2), size * sizeof(TValue1)) == 0);
+        }
+        else
+            return std::ranges::equal(range1, range2);
+    }
+
+    ///////////////////////////
+    // find
+
+    template <std::ranges::input_range TRange, typename T>
+        requires std::equality_comparable_with<std::ranges::range_reference_t<TRange>, const T&>
+    std::ranges::borrowed_iterator_t<TRange> find(TRange&& range, const T& value)
+    {
+        using TValue = std::ranges::range_value_t<TRange>;
+
+        if constexpr (ContiguousTrivialRange<TRange> && std::ranges::borrowed_range<TRange> && std::is_scalar_v<TValue>
+            && std::convertible_to<const T&, TValue>)
+        {
+            const TValue* const first = std::ranges::data(range);
+            const TValue* const last = first + std::ranges::size(range);
+            const auto item = static_cast<TValue>(value);
+
+            if (static_cast<T>(item) != value) // value not representable in TValue (e.g. 300 in a range of chars)
+                return std::ranges::begin(range) + (last - first);
+
+            const TValue* found;
+            if constexpr (sizeof(TValue) == 1 && std::integral<TValue>)
+            {
+                const void* position = first == last ? nullptr : std::memchr(first, std::bit_cast<unsigned char>(item), static_cast<size_t>(last - first));
+                found = position ? static_cast<const TValue*>(position) : last;
+            }
+            else
+                found = Detail::find_blocked(first, last, item);
+
+            return std::ranges::begin(range) + (found - first);
+        }
+        else
+            return std::ranges::find(range, value);
+    }
+
+    ///////////////////////////
+    // hash_range
+    //
+    // Contiguous ranges of bitwise comparable items are hashed as bytes - hash values are equal for equal
+    // ranges of the same kind, but a std::vector<int> and a std::list<int> with the same items hash differently.
+
+    template <std::ranges::input_range TRange>
+    size_t hash_range(TRange&& range)
+    {
+        using TValue = std::ranges::range_value_t<TRange>;
+
+        if constexpr (ContiguousBitwiseComparableRange<TRange>)
+        {
+            const auto bytes = std::as_bytes(std::span{std::ranges::data(range), std::ranges::size(range)});
+            return static_cast<size_t>(Detail::hash_bytes(bytes.data(), bytes.size()));
+        }
+        else
+        {
+            uint64_t h = 0;
+            for (const auto& item : range)
+                h = Detail::mix64(h ^ (std::hash<TValue>{}(item) + 0x9E3779B97F4A7C15ull + (h << 6) + (h >> 2)));
+            return static_cast<size_t>(h);
+        }
+    }
+} // namespace Algorithms
+
+#endif
@@ -0,0 +1,215 @@
+#include "contiguous_algorithms.hpp"
+
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <deque>
+#include <list>
+#include <numeric>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    struct Padded
+    {
+        char c;
+        int i;
+
+        bool operator==(const Padded&) const = default;
+    };
+} // namespace
+
+static_assert(Algorithms::ContiguousBitwiseComparableRange<std::vector<int>&>);
+static_assert(Algorithms::ContiguousBitwiseComparableRange<std::span<const char>>);
+static_assert(Algorithms::ContiguousBitwiseComparableRange<std::string&>);
+static_assert(!Algorithms::ContiguousBitwiseComparableRange<std::vector<double>&>); // 0.0 == -0.0, NaN != NaN
+static_assert(!Algorithms::ContiguousBitwiseComparableRange<std::vector<Padded>&>);
+static_assert(Algorithms::ContiguousTrivialRange<std::vector<Padded>&>);
+static_assert(!Algorithms::ContiguousTrivialRange<std::deque<int>&>);
+
+TEST_CASE("Algorithms::copy")
+{
+    const std::array source = {1, 2, 3, 4};
+
+    SECTION("contiguous -> contiguous")
+    {
+        std::vector<int> target(4);
+        auto end = Algorithms::copy(source, target.begin());
+        CHECK(end == target.end());
+        CHECK(target == std::vector{1, 2, 3, 4});
+    }
+
+    SECTION("contiguous -> back_inserter")
+    {
+        std::list<int> target;
+        Algorithms::copy(source, std::back_inserter(target));
+        CHECK(target == std::list{1, 2, 3, 4});
+    }
+
+    SECTION("list -> raw array")
+    {
+        const std::list<std::string> words = {"one", "two"};
+        std::string target[2];
+        Algorithms::copy(words, target);
+        CHECK(target[1] == "two");
+    }
+}
+
+TEST_CASE("Algorithms::fill")
+{
+    std::vector<int> vec(100, 7);
+    Algorithms::fill(vec, 0);
+    CHECK(std::ranges::all_of(vec, [](int x) { return x == 0; }));
+    Algorithms::fill(vec, -1);
+    CHECK(std::ranges::all_of(vec, [](int x) { return x == -1; }));
+
+    std::string text(10, 'a');
+    Algorithms::fill(text, 'z');
+    CHECK(text == "zzzzzzzzzz");
+
+    std::vector<double> numbers(8, 1.0);
+    Algorithms::fill(std::span{numbers}.subspan(2, 3), -0.0);
+    CHECK(numbers == std::vector{1.0, 1.0, -0.0, -0.0, -0.0, 1.0, 1.0, 1.0});
+    CHECK(std::signbit(numbers[2]));
+
+    std::list<int> lst(3);
+    Algorithms::fill(lst, 5);
+    CHECK(lst == std::list{5, 5, 5});
+}
+
+TEST_CASE("Algorithms::equal")
+{
+    const std::vector<int> vec = {1, 2, 3};
+    const std::array arr = {1, 2, 3};
+    const std::list<int> lst = {1, 2, 3};
+
+    CHECK(Algorithms::equal(vec, arr));
+    CHECK(Algorithms::equal(vec, lst));
+    CHECK_FALSE(Algorithms::equal(vec, std::span{arr}.first(2)));
+    CHECK(Algorithms::equal(std::string{"text"}, "text"sv));
+
+    SECTION("floating point compares values - not bytes")
+    {
+        CHECK(Algorithms::equal(std::vector{0.0}, std::vector{-0.0}));
+    }
+
+    SECTION("padded structs compare members")
+    {
+        Padded a[1];
+        Padded b[1];
+        std::memset(a, 0xAA, sizeof(a));
+        std::memset(b, 0x55, sizeof(b));
+        a[0] = b[0] = Padded{'x', 42};
+        CHECK(Algorithms::equal(a, b));
+    }
+}
+
+TEST_CASE("Algorithms::find")
+{
+    std::vector<int> vec(1000);
+    std::iota(vec.begin(), vec.end(), 0);
+
+    CHECK(Algorithms::find(vec, 777) == vec.begin() + 777);
+    CHECK(Algorithms::find(vec, 5) == vec.begin() + 5);
+    CHECK(Algorithms::find(vec, -1) == vec.end());
+
+    const std::string text = "hello, world";
+    CHECK(Algorithms::find(text, 'w') == text.begin() + 7);
+    CHECK(Algorithms::find(text, 'w' + 256) == text.end());
+    CHECK(Algorithms::find(std::string_view{}, 'a') == std::string_view{}.end());
+
+    const std::list<int> lst = {3, 1, 4};
+    CHECK(Algorithms::find(lst, 4) == std::prev(lst.end()));
+}
+
+TEST_CASE("Algorithms::hash_range")
+{
+    const std::vector<int> vec1 = {1, 2, 3};
+    const std::vector<int> vec2 = {1, 2, 3};
+    const std::array<int, 3> arr = {1, 2, 3};
+
+    CHECK(Algorithms::hash_range(vec1) == Algorithms::hash_range(vec2));
+    CHECK(Algorithms::hash_range(vec1) == Algorithms::hash_range(arr));
+    CHECK(Algorithms::hash_range(vec1) != Algorithms::hash_range(std::vector{1, 2, 4}));
+    CHECK(Algorithms::hash_range(vec1) != Algorithms::hash_range(std::vector{1, 2}));
+
+    const std::list<int> lst1 = {1, 2, 3};
+    CHECK(Algorithms::hash_range(lst1) == Algorithms::hash_range(std::list{1, 2, 3}));
+    CHECK(Algorithms::hash_range(lst1) != Algorithms::hash_range(std::list{3, 2, 1}));
+}
+
+TEST_CASE("Algorithms - benchmark", "[.][benchmark]")
+{
+    constexpr size_t n = 100'000;
+
+    std::vector<int> vec(n);
+    std::iota(vec.begin(), vec.end(), 0);
+    const std::vector<int> vec_copy = vec;
+    const std::deque<int> dq(vec.begin(), vec.end());
+    std::vector<int> target(n);
+
+    const std::string text(n, 'a');
+    const int last_value = static_cast<int>(n - 1);
+
+    BENCHMARK("find - vector - std::ranges::find")
+    {
+        return std::ranges::find(vec, last_value);
+    };
+
+    BENCHMARK("find - vector - Algorithms::find")
+    {
+        return Algorithms::find(vec, last_value);
+    };
+
+    BENCHMARK("find - string - std::ranges::find")
+    {
+        return std::ranges::find(text, 'b');
+    };
+
+    BENCHMARK("find - string - Algorithms::find (memchr)")
+    {
+        return Algorithms::find(text, 'b');
+    };
+
+    BENCHMARK("find - deque - Algorithms::find (fallback)")
+    {
+        return Algorithms::find(dq, last_value);
+    };
+
+    BENCHMARK("equal - vector - std::ranges::equal")
+    {
+        return std::ranges::equal(vec, vec_copy);
+    };
+
+    BENCHMARK("equal - vector - Algorithms::equal")
+    {
+        return Algorithms::equal(vec, vec_copy);
+    };
+
+    BENCHMARK("copy - deque -> vector - Algorithms::copy (fallback)")
+    {
+        return Algorithms::copy(dq, target.begin());
+    };
+
+    BENCHMARK("copy - vector -> vector - Algorithms::copy")
+    {
+        return Algorithms::copy(vec, target.begin());
+    };
+
+    BENCHMARK("hash - vector - element-wise std::hash")
+    {
+        size_t h = 0;
+        for (int item : vec)
+            h ^= std::hash<int>{}(item) + 0x9E3779B9 + (h << 6) + (h >> 2);
+        return h;
+    };
+
+    BENCHMARK("hash - vector - Algorithms::hash_range")
+    {
+        return Algorithms::hash_range(vec);
+    };
+}
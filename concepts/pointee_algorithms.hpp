@@ -0,0 +1,146 @@
+#ifndef POINTEE_ALGORITHMS_HPP
+#define POINTEE_ALGORITHMS_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+
+/////////////////////////////////////////////////////////////////////////////////
+// Reductions over ranges of pointers (raw pointers, std::shared_ptr, std::unique_ptr...)
+//
+// max_element_by_pointee(rng) - like std::ranges::max_element(rng, {}, [](auto& p) { return *p; })
+//
+// Every step of a naive loop dereferences a pointer to a (probably) cold cache line. Here pointees
+// are prefetched a few blocks ahead of the cursor; arithmetic pointees are gathered block by block
+// into a contiguous buffer, so the max of a block is a vectorizable reduction.
+
+namespace Pointees
+{
+    // the same requirements as Cpp20::PointerLike in concepts_and_constraints.cpp
+    template <typename T>
+    concept PointerLike = requires(T ptr) {
+        *ptr;
+        ptr == nullptr;
+        ptr != nullptr;
+    };
+
+    template <PointerLike TPtr>
+    using pointee_t = std::remove_cvref_t<decltype(*std::declval<TPtr&>())>;
+
+    namespace Detail
+    {
+        inline constexpr ptrdiff_t block_size = 32;
+        inline constexpr ptrdiff_t prefetch_distance = 4 * block_size;
+
+        template <typename TPtr>
+        void prefetch_pointee(const TPtr& ptr)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            if constexpr (requires { std::to_address(ptr); }) // no dereference - prefetching nullptr is harmless
+                __builtin_prefetch(static_cast<const void*>(std::to_address(ptr)));
+#else
+            (void)ptr;
+#endif
+        }
+
+        template <typename TIterator>
+        TIterator max_element_by_pointee_serial(TIterator first, TIterator last)
+        {
+            if (first == last)
+                return last;
+
+            assert(*first != nullptr);
+            TIterator best = first;
+            for (++first; first != last; ++first)
+            {
+                if constexpr (std::random_access_iterator<TIterator>)
+                {
+                    if (last - first > prefetch_distance)
+                        prefetch_pointee(first[prefetch_distance]);
+                }
+
+                assert(*first != nullptr);
+                if (**best < **first)
+                    best = first;
+            }
+            return best;
+        }
+
+        template <std::random_access_iterator TIterator>
+        TIterator max_element_by_pointee_gathered(TIterator first, TIterator last)
+        {
+            using TValue = pointee_t<std::iter_value_t<TIterator>>;
+
+            const ptrdiff_t size = last - first;
+            if (size == 0)
+                return last;
+
+            for (ptrdiff_t i = 0; i < std::min(prefetch_distance, size); ++i)
+                prefetch_pointee(first[i]);
+
+            assert(first[0] != nullptr);
+            TValue best_value = *first[0];
+            ptrdiff_t best_index = 0;
+
+            TValue buffer[block_size];
+            for (ptrdiff_t block_start = 0; block_start < size; block_start += block_size)
+            {
+                const ptrdiff_t count = std::min(block_size, size - block_start);
+
+                for (ptrdiff_t i = block_start + prefetch_distance; i < std::min(block_start + prefetch_distance + count, size); ++i)
+                    prefetch_pointee(first[i]);
+
+                // gather
+                for (ptrdiff_t i = 0; i < count; ++i)
+                {
+                    assert(first[block_start + i] != nullptr);
+                    buffer[i] = *first[block_start + i];
+                }
+
+                // vectorizable max - NaNs never win a comparison, as in the serial loop
+                TValue block_max = best_value;
+                for (ptrdiff_t i = 0; i < count; ++i)
+                    block_max = block_max < buffer[i] ? buffer[i] : block_max;
+
+                if (best_value < block_max) // rare after the first blocks - find the first position of the new max
+                {
+                    for (ptrdiff_t i = 0; i < count; ++i)
+                    {
+                        if (best_value < buffer[i])
+                        {
+                            best_value = buffer[i];
+                            best_index = block_start + i;
+                        }
+                    }
+                }
+            }
+
+            return first + best_index;
+        }
+    } // namespace Detail
+
+    // returns iterator to the first pointer to the greatest pointee; pointers must not be null
+    template <std::ranges::forward_range TRange>
+        requires PointerLike<std::ranges::range_value_t<TRange>> && std::totally_ordered<pointee_t<std::ranges::range_value_t<TRange>>>
+    std::ranges::borrowed_iterator_t<TRange> max_element_by_pointee(TRange&& range)
+    {
+        using TValue = pointee_t<std::ranges::range_value_t<TRange>>;
+
+        if constexpr (!std::ranges::borrowed_range<TRange>)
+            return std::ranges::dangling{}; // the result would dangle anyway
+        else if constexpr (std::ranges::random_access_range<TRange> && std::ranges::sized_range<TRange> && std::is_arithmetic_v<TValue>)
+        {
+            auto first = std::ranges::begin(range);
+            return Detail::max_element_by_pointee_gathered(first, first + std::ranges::distance(range));
+        }
+        else
+            return Detail::max_element_by_pointee_serial(std::ranges::begin(range), std::ranges::end(range));
+    }
+} // namespace Pointees
+
+#endif
@@ -0,0 +1,119 @@
+#include "pointee_algorithms.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <limits>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("max_element_by_pointee")
+{
+    SECTION("raw pointers")
+    {
+        int values[] = {7, 42, 3, 42, 1};
+        std::vector<int*> ptrs;
+        for (int& value : values)
+            ptrs.push_back(&value);
+
+        auto it = Pointees::max_element_by_pointee(ptrs);
+        CHECK(*it == &values[1]); // first of equal maxima
+    }
+
+    SECTION("shared_ptrs - many blocks")
+    {
+        std::vector<std::shared_ptr<long>> ptrs;
+        for (long i = 0; i < 1000; ++i)
+            ptrs.push_back(std::make_shared<long>((i * 7919) % 1009));
+
+        const auto expected = std::ranges::max_element(ptrs, {}, [](const auto& ptr) { return *ptr; });
+        CHECK(Pointees::max_element_by_pointee(ptrs) == expected);
+    }
+
+    SECTION("unique_ptrs to strings")
+    {
+        std::vector<std::unique_ptr<std::string>> ptrs;
+        ptrs.push_back(std::make_unique<std::string>("abc"));
+        ptrs.push_back(std::make_unique<std::string>("xyz"));
+        ptrs.push_back(std::make_unique<std::string>("klm"));
+
+        CHECK(**Pointees::max_element_by_pointee(ptrs) == "xyz");
+    }
+
+    SECTION("list of pointers")
+    {
+        double a = 1.0, b = 3.0, c = 2.0;
+        std::list<const double*> ptrs = {&a, &b, &c};
+        CHECK(*Pointees::max_element_by_pointee(ptrs) == &b);
+    }
+
+    SECTION("NaNs behave as in std::max_element")
+    {
+        constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+        std::vector<double> values = {nan, 1.0, 5.0, nan, 2.0};
+        std::vector<double*> ptrs;
+        for (double& value : values)
+            ptrs.push_back(&value);
+
+        const auto expected = std::ranges::max_element(ptrs, {}, [](double* ptr) { return *ptr; });
+        CHECK(Pointees::max_element_by_pointee(ptrs) == expected);
+
+        std::swap(ptrs[0], ptrs[2]);
+        CHECK(**Pointees::max_element_by_pointee(ptrs) == 5.0);
+    }
+
+    SECTION("empty range")
+    {
+        std::vector<int*> ptrs;
+        CHECK(Pointees::max_element_by_pointee(ptrs) == ptrs.end());
+    }
+}
+
+TEST_CASE("max_element_by_pointee - benchmark", "[.][benchmark]")
+{
+    constexpr size_t n = 1'000'000;
+
+    std::mt19937 rnd_gen{665};
+    std::uniform_int_distribution<int> distr(0, 1'000'000'000);
+
+    // pointees scattered over a large buffer - every dereference is a cache miss
+    std::vector<int> storage(n);
+    std::ranges::generate(storage, [&] { return distr(rnd_gen); });
+    std::vector<int*> raw_ptrs(n);
+    std::ranges::transform(storage, raw_ptrs.begin(), [](int& value) { return &value; });
+    std::ranges::shuffle(raw_ptrs, rnd_gen);
+
+    std::vector<std::shared_ptr<int>> shared_ptrs;
+    shared_ptrs.reserve(n);
+    for (int* ptr : raw_ptrs)
+        shared_ptrs.push_back(std::make_shared<int>(*ptr));
+    std::ranges::shuffle(shared_ptrs, rnd_gen);
+
+    const auto deref = [](const auto& ptr) { return *ptr; };
+
+    BENCHMARK("raw pointers - std::ranges::max_element")
+    {
+        return std::ranges::max_element(raw_ptrs, {}, deref);
+    };
+
+    BENCHMARK("raw pointers - max_element_by_pointee")
+    {
+        return Pointees::max_element_by_pointee(raw_ptrs);
+    };
+
+    BENCHMARK("shared_ptrs - std::ranges::max_element")
+    {
+        return std::ranges::max_element(shared_ptrs, {}, deref);
+    };
+
+    BENCHMARK("shared_ptrs - max_element_by_pointee")
+    {
+        return Pointees::max_element_by_pointee(shared_ptrs);
+    };
+}
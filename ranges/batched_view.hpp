@@ -0,0 +1,450 @@
+#ifndef BATCHED_VIEW_HPP
+#define BATCHED_VIEW_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <ranges>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////
+// Batched views
+//
+// rng | views::batched(n)  - range of std::span<T> blocks with n elements (last one may be shorter)
+// rng | views::batched()   - blocks sized to fit in L1 cache
+//
+// Contiguous ranges are split into spans without copying. Other sized ranges are
+// copied batch by batch into an internal buffer (single-pass input range).
+
+namespace Ranges
+{
+    inline constexpr size_t l1_cache_size = 32 * 1024;
+    inline constexpr size_t l2_cache_size = 256 * 1024;
+
+    template <typename T>
+    constexpr size_t batch_size_for(size_t cache_size = l1_cache_size)
+    {
+        return std::max<size_t>(1, cache_size / sizeof(T));
+    }
+
+    ///////////////////////////
+    // BatchedView - contiguous ranges
+
+    template <std::ranges::view V>
+        requires std::ranges::contiguous_range<const V> && std::ranges::sized_range<const V>
+    class BatchedView : public std::ranges::view_interface<BatchedView<V>>
+    {
+        using TElement = std::remove_reference_t<std::ranges::range_reference_t<const V>>;
+
+        V base_;
+        size_t batch_size_;
+
+    public:
+        class Iterator
+        {
+            TElement* data_ = nullptr;
+            size_t size_ = 0;
+            size_t batch_size_ = 1;
+            size_t index_ = 0;
+
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = std::span<TElement>;
+            using difference_type = std::ptrdiff_t;
+
+            Iterator() = default;
+
+            Iterator(TElement* data, size_t size, size_t batch_size, size_t index)
+                : data_{data}, size_{size}, batch_size_{batch_size}, index_{index}
+            {
+            }
+
+            std::span<TElement> operator*() const
+            {
+                const size_t offset = index_ * batch_size_;
+                return {data_ + offset, std::min(batch_size_, size_ - offset)};
+            }
+
+            std::span<TElement> operator[](difference_type n) const
+            {
+                return *(*this + n);
+            }
+
+            Iterator& operator++()
+            {
+                ++index_;
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                auto tmp = *this;
+                ++index_;
+                return tmp;
+            }
+
+            Iterator& operator--()
+            {
+                --index_;
+                return *this;
+            }
+
+            Iterator operator--(int)
+            {
+                auto tmp = *this;
+                --index_;
+                return tmp;
+            }
+
+            Iterator& operator+=(difference_type n)
+            {
+                index_ += n;
+                return *this;
+            }
+
+            Iterator& operator-=(difference_type n)
+            {
+                index_ -= n;
+                return *this;
+            }
+
+            friend Iterator operator+(Iterator it, difference_type n)
+            {
+                return it += n;
+            }
+
+            friend Iterator operator+(difference_type n, Iterator it)
+            {
+                return it += n;
+            }
+
+            friend Iterator operator-(Iterator it, difference_type n)
+            {
+                return it -= n;
+            }
+
+            friend difference_type operator-(const Iterator& a, const Iterator& b)
+            {
+                return static_cast<difference_type>(a.index_) - static_cast<difference_type>(b.index_);
+            }
+
+            friend bool operator==(const Iterator& a, const Iterator& b)
+            {
+                return a.index_ == b.index_;
+            }
+
+            friend auto operator<=>(const Iterator& a, const Iterator& b)
+            {
+                return a.index_ <=> b.index_;
+            }
+        };
+
+        BatchedView() = default;
+
+        BatchedView(V base, size_t batch_size)
+            : base_{std::move(base)}, batch_size_{batch_size}
+        {
+            assert(batch_size_ > 0);
+        }
+
+        V base() const
+        {
+            return base_;
+        }
+
+        size_t batch_size() const
+        {
+            return batch_size_;
+        }
+
+        Iterator begin() const
+        {
+            return Iterator{std::ranges::data(base_), std::ranges::size(base_), batch_size_, 0};
+        }
+
+        Iterator end() const
+        {
+            return Iterator{std::ranges::data(base_), std::ranges::size(base_), batch_size_, size()};
+        }
+
+        size_t size() const
+        {
+            return (std::ranges::size(base_) + batch_size_ - 1) / batch_size_;
+        }
+    };
+
+    ///////////////////////////
+    // BufferedBatchedView - sized ranges without contiguous storage
+
+    template <std::ranges::view V>
+        requires std::ranges::input_range<V> && std::ranges::sized_range<V>
+    class BufferedBatchedView : public std::ranges::view_interface<BufferedBatchedView<V>>
+    {
+        using TValue = std::ranges::range_value_t<V>;
+
+        V base_;
+        size_t batch_size_;
+        std::ranges::iterator_t<V> current_;
+        std::vector<TValue> buffer_;
+
+        void fill_buffer()
+        {
+            buffer_.clear();
+            for (auto last = std::ranges::end(base_); current_ != last && buffer_.size() < batch_size_; ++current_)
+                buffer_.push_back(*current_);
+        }
+
+    public:
+        class Iterator
+        {
+            BufferedBatchedView* parent_ = nullptr;
+
+        public:
+            using iterator_concept = std::input_iterator_tag;
+            using value_type = std::span<const TValue>;
+            using difference_type = std::ptrdiff_t;
+
+            Iterator() = default;
+
+            explicit Iterator(BufferedBatchedView* parent)
+                : parent_{parent}
+            {
+            }
+
+            std::span<const TValue> operator*() const
+            {
+                return parent_->buffer_;
+            }
+
+            Iterator& operator++()
+            {
+                parent_->fill_buffer();
+                return *this;
+            }
+
+            void operator++(int)
+            {
+                ++*this;
+            }
+
+            bool operator==(std::default_sentinel_t) const
+            {
+                return parent_->buffer_.empty();
+            }
+        };
+
+        BufferedBatchedView() = default;
+
+        BufferedBatchedView(V base, size_t batch_size)
+            : base_{std::move(base)}, batch_size_{batch_size}
+        {
+            assert(batch_size_ > 0);
+            buffer_.reserve(batch_size_);
+        }
+
+        Iterator begin()
+        {
+            current_ = std::ranges::begin(base_);
+            fill_buffer();
+            return Iterator{this};
+        }
+
+        std::default_sentinel_t end() const
+        {
+            return std::default_sentinel;
+        }
+
+        size_t size()
+        {
+            return (std::ranges::size(base_) + batch_size_ - 1) / batch_size_;
+        }
+    };
+
+    ///////////////////////////
+    // executors - run f(0), ..., f(n-1) and wait for completion
+
+    struct InlineExecutor
+    {
+        template <typename F>
+        void bulk(size_t n, F&& f) const
+        {
+            for (size_t i = 0; i < n; ++i)
+                f(i);
+        }
+    };
+
+    class ThreadExecutor
+    {
+        unsigned threads_count_;
+
+    public:
+        explicit ThreadExecutor(unsigned threads_count = std::max(1u, std::thread::hardware_concurrency()))
+            : threads_count_{threads_count}
+        {
+        }
+
+        template <typename F>
+        void bulk(size_t n, F&& f) const
+        {
+            std::atomic<size_t> next_index{0};
+            std::exception_ptr eptr;
+            std::mutex mtx_eptr;
+
+            auto worker = [&] {
+                for (size_t i = next_index++; i < n; i = next_index++)
+                {
+                    try
+                    {
+                        f(i);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard lk{mtx_eptr};
+                        if (!eptr)
+                            eptr = std::current_exception();
+                    }
+                }
+            };
+
+            {
+                std::vector<std::jthread> threads;
+                const auto count = std::min<size_t>(threads_count_, n);
+                for (size_t i = 1; i < count; ++i)
+                    threads.emplace_back(worker);
+                worker();
+            } // join
+
+            if (eptr)
+                std::rethrow_exception(eptr);
+        }
+    };
+
+    template <typename E>
+    concept Executor = requires(const E& ex, void (*f)(size_t)) {
+        ex.bulk(size_t{}, f);
+    };
+
+    // executor is stored by value (as other arguments of range adaptors) - the view does not dangle
+    template <typename V, Executor TExecutor>
+    class ExecutorBatchedView : public BatchedView<V>
+    {
+        TExecutor executor_;
+
+    public:
+        ExecutorBatchedView(V base, size_t batch_size, TExecutor executor)
+            : BatchedView<V>{std::move(base), batch_size}, executor_{std::move(executor)}
+        {
+        }
+
+        // calls f(batch) for every batch - batches are distributed by the executor
+        template <typename F>
+        void for_each(F f) const
+        {
+            auto first = this->begin();
+            executor_.bulk(this->size(), [&](size_t i) { f(first[i]); });
+        }
+    };
+
+    ///////////////////////////
+    // adaptors
+
+    namespace views
+    {
+        namespace Detail
+        {
+            struct BatchedClosure
+            {
+                size_t batch_size;
+
+                template <std::ranges::viewable_range R>
+                friend auto operator|(R&& rng, BatchedClosure closure)
+                {
+                    using V = std::views::all_t<R>;
+                    if constexpr (std::ranges::contiguous_range<const V> && std::ranges::sized_range<const V>)
+                        return BatchedView<V>{std::views::all(std::forward<R>(rng)), closure.batch_size};
+                    else
+                        return BufferedBatchedView<V>{std::views::all(std::forward<R>(rng)), closure.batch_size};
+                }
+            };
+
+            template <typename TExecutor>
+            struct BatchedOnClosure
+            {
+                TExecutor executor;
+                size_t batch_size;
+
+                template <std::ranges::viewable_range R>
+                    requires std::ranges::contiguous_range<R> && std::ranges::sized_range<R>
+                friend auto operator|(R&& rng, BatchedOnClosure closure)
+                {
+                    using V = std::views::all_t<R>;
+                    return ExecutorBatchedView<V, TExecutor>{std::views::all(std::forward<R>(rng)), closure.batch_size, std::move(closure.executor)};
+                }
+            };
+
+            struct DefaultBatchedClosure
+            {
+                template <std::ranges::viewable_range R>
+                friend auto operator|(R&& rng, DefaultBatchedClosure)
+                {
+                    return std::forward<R>(rng) | BatchedClosure{batch_size_for<std::ranges::range_value_t<R>>()};
+                }
+            };
+
+            struct BatchedFn
+            {
+                BatchedClosure operator()(size_t batch_size) const
+                {
+                    assert(batch_size > 0);
+                    return {batch_size};
+                }
+
+                DefaultBatchedClosure operator()() const
+                {
+                    return {};
+                }
+
+                template <std::ranges::viewable_range R>
+                auto operator()(R&& rng, size_t batch_size) const
+                {
+                    assert(batch_size > 0);
+                    return std::forward<R>(rng) | BatchedClosure{batch_size};
+                }
+
+                template <std::ranges::viewable_range R>
+                auto operator()(R&& rng) const
+                {
+                    return std::forward<R>(rng) | DefaultBatchedClosure{};
+                }
+            };
+        } // namespace Detail
+
+        inline constexpr Detail::BatchedFn batched;
+
+        // executor is copied into the view
+        template <typename TExecutor>
+            requires Executor<std::decay_t<TExecutor>>
+        auto batched_on(TExecutor&& executor, size_t batch_size)
+        {
+            assert(batch_size > 0);
+            return Detail::BatchedOnClosure<std::decay_t<TExecutor>>{std::forward<TExecutor>(executor), batch_size};
+        }
+    } // namespace views
+} // namespace Ranges
+
+namespace std::ranges
+{
+    template <typename V>
+    inline constexpr bool enable_borrowed_range<::Ranges::BatchedView<V>> = enable_borrowed_range<V>;
+}
+
+#endif
@@ -0,0 +1,160 @@
+#include "batched_view.hpp"
+
+#include <algorithm>
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <list>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("views::batched")
+{
+    std::vector<int> vec(10);
+    std::iota(vec.begin(), vec.end(), 1);
+
+    SECTION("contiguous range - spans without copying")
+    {
+        auto batches = vec | Ranges::views::batched(4);
+
+        static_assert(std::ranges::random_access_range<decltype(batches)>);
+        static_assert(std::is_same_v<std::ranges::range_value_t<decltype(batches)>, std::span<int>>);
+
+        REQUIRE(batches.size() == 3);
+        CHECK(std::ranges::equal(batches[0], std::array{1, 2, 3, 4}));
+        CHECK(std::ranges::equal(batches[2], std::array{9, 10}));
+        CHECK(batches[1].data() == vec.data() + 4);
+
+        for (auto batch : batches)
+            std::ranges::transform(batch, batch.begin(), [](int x) { return x * x; });
+
+        CHECK(vec == std::vector{1, 4, 9, 16, 25, 36, 49, 64, 81, 100});
+    }
+
+    SECTION("batches can be piped into std::views")
+    {
+        auto sums = vec
+            | Ranges::views::batched(5)
+            | std::views::transform([](auto batch) { return std::accumulate(batch.begin(), batch.end(), 0); });
+
+        CHECK(std::ranges::equal(sums, std::array{15, 40}));
+    }
+
+    SECTION("default batch size fits in L1 cache")
+    {
+        std::vector<double> data(100'000);
+        auto batches = Ranges::views::batched(data);
+
+        CHECK(batches[0].size() == Ranges::l1_cache_size / sizeof(double));
+        CHECK(std::ranges::equal(data | Ranges::views::batched(), batches, [](auto a, auto b) { return a.data() == b.data(); }));
+    }
+
+    SECTION("sized range without contiguous storage - batches are buffered")
+    {
+        std::list lst{1, 2, 3, 4, 5, 6, 7};
+
+        std::vector<std::vector<int>> batches;
+        for (auto batch : lst | Ranges::views::batched(3))
+            batches.emplace_back(batch.begin(), batch.end());
+
+        CHECK(batches == std::vector<std::vector<int>>{{1, 2, 3}, {4, 5, 6}, {7}});
+
+        auto squares = std::views::iota(0, 10) | Ranges::views::batched(4);
+        CHECK(std::ranges::distance(squares) == 3);
+    }
+
+    SECTION("empty range")
+    {
+        std::vector<int> empty;
+        CHECK((empty | Ranges::views::batched(4)).empty());
+    }
+}
+
+TEST_CASE("views::batched_on - executor-aware batches")
+{
+    std::vector<int> vec(10'000);
+    std::iota(vec.begin(), vec.end(), 0);
+
+    auto square_batch = [](std::span<int> batch) {
+        for (auto& x : batch)
+            x = x * x;
+    };
+
+    SECTION("inline executor")
+    {
+        Ranges::InlineExecutor executor;
+        (vec | Ranges::views::batched_on(executor, 1000)).for_each(square_batch);
+    }
+
+    SECTION("thread executor")
+    {
+        Ranges::ThreadExecutor executor{4};
+        (vec | Ranges::views::batched_on(executor, 1000)).for_each(square_batch);
+    }
+
+    CHECK(std::ranges::equal(vec, std::views::iota(0, 10'000) | std::views::transform([](int x) { return x * x; })));
+}
+
+TEST_CASE("views::batched_on - temporary executor is stored in the view")
+{
+    std::vector<int> vec(1'000, 2);
+
+    auto batches = vec | Ranges::views::batched_on(Ranges::ThreadExecutor{2}, 64);
+    batches.for_each([](std::span<int> batch) {
+        for (auto& x : batch)
+            x *= 3;
+    });
+
+    CHECK(std::ranges::all_of(vec, [](int x) { return x == 6; }));
+}
+
+TEST_CASE("views::batched_on - exceptions are propagated")
+{
+    std::vector<int> vec(100);
+    Ranges::ThreadExecutor executor{4};
+
+    auto batches = vec | Ranges::views::batched_on(executor, 10);
+
+    CHECK_THROWS_AS(batches.for_each([](std::span<int> batch) {
+        if (batch.data() != nullptr)
+            throw std::runtime_error("error");
+    }),
+        std::runtime_error);
+}
+
+TEST_CASE("views::batched - benchmark transform(x*x)", "[.][benchmark]")
+{
+    constexpr size_t n = 10'000'000;
+
+    std::vector<float> src(n);
+    std::iota(src.begin(), src.end(), 0.0f);
+    std::vector<float> dest(n);
+
+    auto square = [](float x) { return x * x; };
+
+    BENCHMARK("views::transform")
+    {
+        return std::ranges::copy(src | std::views::transform(square), dest.begin()).out;
+    };
+
+    BENCHMARK("views::batched | transform per batch")
+    {
+        for (auto batch : src | Ranges::views::batched())
+            std::ranges::transform(batch, dest.begin() + (batch.data() - src.data()), square);
+        return dest.data();
+    };
+
+    BENCHMARK("views::batched_on(ThreadExecutor)")
+    {
+        Ranges::ThreadExecutor executor;
+        (src | Ranges::views::batched_on(executor, Ranges::batch_size_for<float>(Ranges::l2_cache_size))).for_each([&](std::span<float> batch) {
+            std::ranges::transform(batch, dest.begin() + (batch.data() - src.data()), square);
+        });
+        return dest.data();
+    };
+}
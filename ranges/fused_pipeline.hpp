@@ -0,0 +1,315 @@
+#ifndef FUSED_PIPELINE_HPP
+#define FUSED_PIPELINE_HPP
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////
+// Fused pipelines
+//
+// Eager counterpart of chains like: iota(1) | take(100) | filter(pred) | transform(f)
+// Elements are processed in fixed-size blocks - every stage runs a tight loop over
+// the whole block (filter uses branchless compaction), so the compiler can vectorize it.
+// Stages are expected to be pure - a block may evaluate a few more elements
+// than the equivalent lazy view would touch.
+
+namespace Ranges::Fused
+{
+    inline constexpr size_t block_size = 256;
+
+    ///////////////////////////
+    // sources
+
+    template <std::integral T>
+    struct IotaSource
+    {
+        using value_type = T;
+
+        T first;
+        T last = std::numeric_limits<T>::max(); // unbounded iota
+
+        auto as_view() const
+        {
+            return std::views::iota(first, last);
+        }
+
+        template <typename TSink>
+        void generate(TSink&& sink) const
+        {
+            std::array<T, block_size> buffer;
+
+            for (T current = first; current < last; current += static_cast<T>(block_size))
+            {
+                using TUnsigned = std::make_unsigned_t<T>;
+                const auto distance = static_cast<size_t>(static_cast<TUnsigned>(last) - static_cast<TUnsigned>(current));
+                const auto count = std::min(block_size, distance);
+
+                for (size_t i = 0; i < count; ++i)
+                    buffer[i] = static_cast<T>(current + static_cast<T>(i));
+
+                if (!sink(std::span<const T>{buffer.data(), count}) || count == distance)
+                    return;
+            }
+        }
+    };
+
+    template <typename T>
+    struct SpanSource
+    {
+        using value_type = std::remove_cv_t<T>;
+
+        std::span<T> data;
+
+        auto as_view() const
+        {
+            return std::views::all(data);
+        }
+
+        template <typename TSink>
+        void generate(TSink&& sink) const
+        {
+            for (size_t offset = 0; offset < data.size(); offset += block_size)
+            {
+                const auto count = std::min(block_size, data.size() - offset);
+                if (!sink(std::span<const value_type>{data.data() + offset, count}))
+                    return;
+            }
+        }
+    };
+
+    ///////////////////////////
+    // stages
+
+    template <typename TPredicate>
+    struct Filter
+    {
+        TPredicate pred;
+
+        template <typename T>
+        using output_t = T;
+
+        template <typename T>
+        std::span<const T> apply(std::span<const T> in, std::span<T> out)
+        {
+            size_t count = 0;
+            for (size_t i = 0; i < in.size(); ++i)
+            {
+                out[count] = in[i]; // branchless compaction - always write, conditionally advance
+                count += static_cast<bool>(std::invoke(pred, in[i]));
+            }
+            return out.first(count);
+        }
+
+        auto adaptor() const
+        {
+            return std::views::filter(pred);
+        }
+    };
+
+    template <typename F>
+    struct Transform
+    {
+        F func;
+
+        template <typename T>
+        using output_t = std::remove_cvref_t<std::invoke_result_t<const F&, const T&>>;
+
+        template <typename T, typename TOut>
+        std::span<const TOut> apply(std::span<const T> in, std::span<TOut> out)
+        {
+            std::ranges::transform(in, out.begin(), std::cref(func));
+            return out.first(in.size());
+        }
+
+        auto adaptor() const
+        {
+            return std::views::transform(func);
+        }
+    };
+
+    struct Take
+    {
+        size_t count;
+
+        template <typename T>
+        using output_t = T;
+
+        template <typename T>
+        std::span<const T> apply(std::span<const T> in) // no buffer needed - returns prefix of input
+        {
+            auto taken = in.first(std::min(in.size(), count));
+            count -= taken.size();
+            return taken;
+        }
+
+        bool done() const
+        {
+            return count == 0;
+        }
+
+        auto adaptor() const
+        {
+            return std::views::take(count);
+        }
+    };
+
+    namespace Detail
+    {
+        template <typename T, typename... TStages>
+        struct PipelineOutput
+        {
+            using type = T;
+        };
+
+        template <typename T, typename TStage, typename... TStages>
+        struct PipelineOutput<T, TStage, TStages...>
+        {
+            using type = typename PipelineOutput<typename TStage::template output_t<T>, TStages...>::type;
+        };
+    } // namespace Detail
+
+    ///////////////////////////
+    // pipeline
+
+    template <typename TSource, typename... TStages>
+    struct Pipeline
+    {
+        using value_type = typename Detail::PipelineOutput<typename TSource::value_type, TStages...>::type;
+
+        TSource source;
+        std::tuple<TStages...> stages;
+
+        // equivalent lazy view - reference semantics for results
+        auto as_view() const
+        {
+            return std::apply([this](const auto&... stage) { return (source.as_view() | ... | stage.adaptor()); }, stages);
+        }
+
+        // sink is called with std::span<const value_type> blocks; returning false stops the evaluation
+        template <typename TSink>
+        void run(TSink&& sink) const
+        {
+            auto state = stages; // take stages count down - the pipeline itself can be evaluated many times
+            source.generate([&](auto block) { return push_block<0>(state, block, sink); });
+        }
+
+    private:
+        template <size_t I, typename T, typename TSink>
+        static bool push_block(std::tuple<TStages...>& state, std::span<const T> block, TSink& sink)
+        {
+            if constexpr (I == sizeof...(TStages))
+            {
+                return block.empty() || sink(block);
+            }
+            else
+            {
+                auto& stage = std::get<I>(state);
+
+                if constexpr (requires { stage.apply(block); })
+                {
+                    bool more = push_block<I + 1>(state, stage.apply(block), sink);
+                    return more && !stage.done();
+                }
+                else
+                {
+                    using TOut = typename std::remove_cvref_t<decltype(stage)>::template output_t<T>;
+                    std::array<TOut, block_size> buffer;
+                    return push_block<I + 1>(state, stage.apply(block, std::span<TOut>{buffer}), sink);
+                }
+            }
+        }
+    };
+
+    ///////////////////////////
+    // factories & pipe syntax
+
+    template <std::integral T>
+    Pipeline<IotaSource<T>> iota(T first)
+    {
+        return {IotaSource<T>{first}, {}};
+    }
+
+    template <std::integral T>
+    Pipeline<IotaSource<T>> iota(T first, T last)
+    {
+        return {IotaSource<T>{first, last}, {}};
+    }
+
+    template <std::ranges::contiguous_range TRng>
+        requires std::ranges::sized_range<TRng>
+    auto from(TRng& rng)
+    {
+        using T = std::remove_reference_t<std::ranges::range_reference_t<TRng>>;
+        return Pipeline<SpanSource<T>>{SpanSource<T>{std::span<T>{std::ranges::data(rng), std::ranges::size(rng)}}, {}};
+    }
+
+    template <typename TPredicate>
+    Filter<std::decay_t<TPredicate>> filter(TPredicate&& pred)
+    {
+        return {std::forward<TPredicate>(pred)};
+    }
+
+    template <typename F>
+    Transform<std::decay_t<F>> transform(F&& f)
+    {
+        return {std::forward<F>(f)};
+    }
+
+    inline Take take(size_t count)
+    {
+        return {count};
+    }
+
+    template <typename TSource, typename... TStages, typename TStage>
+    Pipeline<TSource, TStages..., TStage> operator|(Pipeline<TSource, TStages...> pipeline, TStage stage)
+    {
+        return {std::move(pipeline.source), std::tuple_cat(std::move(pipeline.stages), std::tuple{std::move(stage)})};
+    }
+
+    ///////////////////////////
+    // evaluation
+
+    template <typename TSource, typename... TStages, std::weakly_incrementable TOutIter>
+    TOutIter evaluate(const Pipeline<TSource, TStages...>& pipeline, TOutIter out)
+    {
+        pipeline.run([&](auto block) {
+            out = std::ranges::copy(block, out).out;
+            return true;
+        });
+        return out;
+    }
+
+    // fills dest until the pipeline is exhausted or dest is full - returns the written part
+    template <typename TSource, typename... TStages, typename T, size_t Extent>
+    std::span<T> evaluate(const Pipeline<TSource, TStages...>& pipeline, std::span<T, Extent> dest)
+    {
+        size_t written = 0;
+        pipeline.run([&](auto block) {
+            const auto count = std::min(block.size(), dest.size() - written);
+            std::ranges::copy(block.first(count), dest.begin() + written);
+            written += count;
+            return written < dest.size();
+        });
+        return dest.first(written);
+    }
+
+    template <typename TSource, typename... TStages>
+    auto to_vector(const Pipeline<TSource, TStages...>& pipeline)
+    {
+        std::vector<typename Pipeline<TSource, TStages...>::value_type> result;
+        evaluate(pipeline, std::back_inserter(result));
+        return result;
+    }
+} // namespace Ranges::Fused
+
+#endif
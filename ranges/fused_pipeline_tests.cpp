@@ -0,0 +1,140 @@
+#include "fused_pipeline.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("fused pipeline - iota | take | filter | transform")
+{
+    auto is_even = [](int x) { return x % 2 == 0; };
+    auto square = [](int x) { return x * x; };
+
+    auto pipeline = Ranges::Fused::iota(1)
+        | Ranges::Fused::take(100)
+        | Ranges::Fused::filter(is_even)
+        | Ranges::Fused::transform(square);
+
+    auto lazy_data = std::views::iota(1)
+        | std::views::take(100)
+        | std::views::filter(is_even)
+        | std::views::transform(square);
+
+    SECTION("results are identical to lazy views")
+    {
+        auto result = Ranges::Fused::to_vector(pipeline);
+
+        CHECK(result.size() == 50);
+        CHECK(std::ranges::equal(result, lazy_data));
+        CHECK(std::ranges::equal(result, pipeline.as_view()));
+    }
+
+    SECTION("evaluation into a destination buffer stops when it is full")
+    {
+        std::array<int, 3> buffer{};
+
+        auto first_3 = Ranges::Fused::evaluate(pipeline, std::span{buffer});
+
+        CHECK(first_3.size() == 3);
+        CHECK(std::ranges::equal(first_3, lazy_data | std::views::take(3)));
+    }
+
+    SECTION("pipeline can be evaluated many times")
+    {
+        CHECK(Ranges::Fused::to_vector(pipeline) == Ranges::Fused::to_vector(pipeline));
+    }
+}
+
+TEST_CASE("fused pipeline - stages spanning many blocks")
+{
+    auto pipeline = Ranges::Fused::iota(-1000, 5000)
+        | Ranges::Fused::filter([](int x) { return x % 3 == 0; })
+        | Ranges::Fused::transform([](int x) { return x * 0.5; })
+        | Ranges::Fused::take(1500)
+        | Ranges::Fused::transform([](double x) { return std::to_string(x); });
+
+    static_assert(std::is_same_v<decltype(pipeline)::value_type, std::string>);
+
+    CHECK(std::ranges::equal(Ranges::Fused::to_vector(pipeline), pipeline.as_view()));
+
+    SECTION("contiguous range as a source")
+    {
+        std::vector<int> vec(1000);
+        std::iota(vec.begin(), vec.end(), 0);
+
+        auto odd_halves = Ranges::Fused::from(vec)
+            | Ranges::Fused::filter([](int x) { return x % 2 != 0; })
+            | Ranges::Fused::transform([](int x) { return x / 2; });
+
+        auto result = Ranges::Fused::to_vector(odd_halves);
+
+        CHECK(result.size() == 500);
+        CHECK(std::ranges::equal(result, odd_halves.as_view()));
+    }
+
+    SECTION("take(0)")
+    {
+        CHECK(Ranges::Fused::to_vector(Ranges::Fused::iota(1) | Ranges::Fused::take(0)).empty());
+    }
+}
+
+TEST_CASE("fused pipeline - benchmark", "[.][benchmark]")
+{
+    constexpr int n = 1'000'000;
+
+    auto is_even = [](int x) { return x % 2 == 0; };
+    auto square = [](int x) { return x * x; };
+
+    std::vector<int> dest(n);
+
+    SECTION("iota source - predictable filter")
+    {
+        BENCHMARK("lazy views")
+        {
+            auto data = std::views::iota(1)
+                | std::views::take(n)
+                | std::views::filter(is_even)
+                | std::views::transform(square);
+            return std::ranges::copy(data, dest.begin()).out;
+        };
+
+        BENCHMARK("fused pipeline")
+        {
+            auto data = Ranges::Fused::iota(1)
+                | Ranges::Fused::take(n)
+                | Ranges::Fused::filter(is_even)
+                | Ranges::Fused::transform(square);
+            return Ranges::Fused::evaluate(data, std::span{dest}).size();
+        };
+    }
+
+    SECTION("random data - unpredictable filter")
+    {
+        std::mt19937 rnd_gen{665};
+        std::uniform_int_distribution<int> distr(0, 1000);
+        std::vector<int> src(n);
+        std::ranges::generate(src, [&] { return distr(rnd_gen); });
+
+        BENCHMARK("lazy views")
+        {
+            auto data = src
+                | std::views::filter(is_even)
+                | std::views::transform(square);
+            return std::ranges::copy(data, dest.begin()).out;
+        };
+
+        BENCHMARK("fused pipeline")
+        {
+            auto data = Ranges::Fused::from(src)
+                | Ranges::Fused::filter(is_even)
+                | Ranges::Fused::transform(square);
+            return Ranges::Fused::evaluate(data, std::span{dest}).size();
+        };
+    }
+}
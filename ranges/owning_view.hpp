@@ -0,0 +1,123 @@
+#ifndef OWNING_VIEW_HPP
+#define OWNING_VIEW_HPP
+
+#include <concepts>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////////////////////
+// Owning pipelines
+//
+// get_data() | views::owning | std::views::filter(...)  - temporary container is moved into
+//                                                         the pipeline (no copy, no dangling) -
+//                                                         as std::views::all does for rvalues
+// rng | to<std::vector<int>>() or rng | to<std::vector>() - materializes the results
+//                                                         (one allocation when the size is known)
+
+namespace Ranges
+{
+    // std::ranges::owning_view (P2415) - std::views::all wraps rvalue containers in it, so
+    // get_data() | std::views::filter(...) is already safe; views::owning only makes the move explicit
+    // and rejects lvalues
+    template <std::ranges::range R>
+    using OwningView = std::ranges::owning_view<R>;
+
+    namespace views
+    {
+        namespace Detail
+        {
+            struct OwningClosure
+            {
+                // only rvalues are accepted - lvalue containers should be used by reference (std::views::all)
+                template <std::ranges::range R>
+                    requires(!std::is_lvalue_reference_v<R> && !std::ranges::view<std::remove_cvref_t<R>>)
+                friend OwningView<std::remove_cvref_t<R>> operator|(R&& rng, OwningClosure)
+                {
+                    return OwningView<std::remove_cvref_t<R>>{std::move(rng)};
+                }
+            };
+        } // namespace Detail
+
+        inline constexpr Detail::OwningClosure owning;
+    } // namespace views
+
+    ///////////////////////////
+    // to<Container>
+
+    namespace Detail
+    {
+        template <typename TContainer, typename R>
+        TContainer to_container(R&& rng)
+        {
+            if constexpr (std::same_as<std::remove_cvref_t<R>, OwningView<TContainer>> && !std::is_lvalue_reference_v<R>)
+            {
+                return std::move(rng).base(); // container owned by a pipeline - moved out
+            }
+            else
+            {
+                TContainer result;
+
+                if constexpr (std::ranges::sized_range<R> && requires { result.reserve(std::ranges::size(rng)); })
+                    result.reserve(std::ranges::size(rng));
+
+                if constexpr (std::ranges::common_range<R> && requires { result.insert(result.end(), std::ranges::begin(rng), std::ranges::end(rng)); })
+                {
+                    result.insert(result.end(), std::ranges::begin(rng), std::ranges::end(rng));
+                }
+                else
+                {
+                    for (auto&& item : rng)
+                    {
+                        if constexpr (requires { result.push_back(std::forward<decltype(item)>(item)); })
+                            result.push_back(std::forward<decltype(item)>(item));
+                        else
+                            result.insert(std::forward<decltype(item)>(item));
+                    }
+                }
+
+                return result;
+            }
+        }
+
+        template <typename TContainer>
+        struct ToClosure
+        {
+            template <std::ranges::input_range R>
+            friend TContainer operator|(R&& rng, ToClosure)
+            {
+                return to_container<TContainer>(std::forward<R>(rng));
+            }
+        };
+
+        template <template <typename...> class TContainer>
+        struct ToTemplateClosure
+        {
+            template <std::ranges::input_range R>
+            friend auto operator|(R&& rng, ToTemplateClosure)
+            {
+                return to_container<TContainer<std::ranges::range_value_t<R>>>(std::forward<R>(rng));
+            }
+        };
+    } // namespace Detail
+
+    template <typename TContainer>
+    Detail::ToClosure<TContainer> to()
+    {
+        return {};
+    }
+
+    template <template <typename...> class TContainer>
+    Detail::ToTemplateClosure<TContainer> to()
+    {
+        return {};
+    }
+
+    template <typename TContainer, std::ranges::input_range R>
+    TContainer to(R&& rng)
+    {
+        return Detail::to_container<TContainer>(std::forward<R>(rng));
+    }
+} // namespace Ranges
+
+#endif
@@ -0,0 +1,133 @@
+#include "owning_view.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <list>
+#include <ranges>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    const int* last_data_buffer = nullptr;
+
+    std::vector<int> load_data()
+    {
+        std::vector<int> vec{1, 2, 3, 42, 22};
+        last_data_buffer = vec.data();
+        return vec;
+    }
+} // namespace
+
+TEST_CASE("views::owning")
+{
+    SECTION("temporary container is moved into the pipeline")
+    {
+        auto evens = load_data()
+            | Ranges::views::owning
+            | std::views::filter([](int x) { return x % 2 == 0; });
+
+        CHECK(std::ranges::equal(evens, std::vector{2, 42, 22}));
+        CHECK(&*evens.begin() == last_data_buffer + 1); // no copy - points into the moved buffer
+    }
+
+    SECTION("same as std::views::all for rvalue containers")
+    {
+        using OwningVector = decltype(load_data() | Ranges::views::owning);
+        static_assert(std::is_same_v<OwningVector, std::views::all_t<std::vector<int>>>);
+
+        auto evens = load_data() | std::views::filter([](int x) { return x % 2 == 0; });
+        CHECK(&*evens.begin() == last_data_buffer + 1);
+    }
+
+    SECTION("borrowed iterators")
+    {
+        auto data = load_data() | Ranges::views::owning;
+
+        auto pos = std::ranges::find(data, 42); // data owns the buffer - iterator is valid
+        REQUIRE(*pos == 42);
+
+        static_assert(std::is_same_v<decltype(std::ranges::find(load_data() | Ranges::views::owning, 42)), std::ranges::dangling>);
+    }
+
+    SECTION("owning view is a move-only view")
+    {
+        using OwningVector = decltype(load_data() | Ranges::views::owning);
+
+        static_assert(std::ranges::view<OwningVector>);
+        static_assert(std::ranges::contiguous_range<OwningVector>);
+        static_assert(!std::copyable<OwningVector>);
+    }
+}
+
+TEST_CASE("to<Container>")
+{
+    SECTION("sized range - exactly one allocation")
+    {
+        auto squares = std::views::iota(1, 1001)
+            | std::views::transform([](int x) { return x * x; })
+            | Ranges::to<std::vector<int>>();
+
+        CHECK(squares.size() == 1000);
+        CHECK(squares.capacity() == 1000);
+        CHECK(squares.back() == 1'000'000);
+    }
+
+    SECTION("container template - value type is deduced")
+    {
+        auto words = std::views::iota(1, 4)
+            | std::views::transform([](int x) { return std::to_string(x); })
+            | Ranges::to<std::list>();
+
+        static_assert(std::is_same_v<decltype(words), std::list<std::string>>);
+        CHECK(words == std::list{"1"s, "2"s, "3"s});
+    }
+
+    SECTION("container without push_back")
+    {
+        auto unique_items = Ranges::to<std::set<int>>(std::vector{3, 1, 3, 2, 1});
+
+        CHECK(unique_items == std::set{1, 2, 3});
+    }
+
+    SECTION("owning view is moved out without copying")
+    {
+        auto owned = load_data() | Ranges::views::owning;
+        auto vec = std::move(owned) | Ranges::to<std::vector>();
+
+        CHECK(vec.data() == last_data_buffer);
+    }
+
+    SECTION("owning pipeline")
+    {
+        auto evens = load_data()
+            | Ranges::views::owning
+            | std::views::filter([](int x) { return x % 2 == 0; })
+            | Ranges::to<std::vector>();
+
+        CHECK(evens == std::vector{2, 42, 22});
+    }
+}
+
+TEST_CASE("to<Container> - benchmark", "[.][benchmark]")
+{
+    constexpr int n = 1'000'000;
+    auto squares = std::views::iota(0, n) | std::views::transform([](int x) { return x * x; });
+
+    BENCHMARK("push_back loop")
+    {
+        std::vector<int> vec;
+        for (int x : squares)
+            vec.push_back(x);
+        return vec;
+    };
+
+    BENCHMARK("to<std::vector>")
+    {
+        return squares | Ranges::to<std::vector>();
+    };
+}
@@ -0,0 +1,210 @@
+#ifndef BYTE_VIEW_HPP
+#define BYTE_VIEW_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////
+// Typed views over raw bytes (wire formats)
+//
+// using Header = Bytes::Layout<
+//     Bytes::Field<"magic", uint16_t, 0, std::endian::big>,
+//     Bytes::Field<"length", uint32_t, 2>>;
+//
+// Bytes::ByteView<Header> header{packet_bytes};
+// auto length = header.get<"length">();
+//
+// Fields are read straight from the buffer (memcpy of sizeof(T) compiles to a single load)
+// and byte-swapped when the field's endianness differs from the native one.
+
+namespace Bytes
+{
+    template <size_t N>
+    struct FixedString
+    {
+        char text[N]{};
+
+        constexpr FixedString(const char (&str)[N])
+        {
+            std::copy_n(str, N, text);
+        }
+
+        constexpr std::string_view view() const
+        {
+            return {text, N - 1};
+        }
+    };
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    constexpr T byteswap(T value) noexcept
+    {
+        auto bytes = std::bit_cast<std::array<std::byte, sizeof(T)>>(value);
+        std::ranges::reverse(bytes);
+        return std::bit_cast<T>(bytes);
+    }
+
+    template <FixedString Name, typename T, size_t Offset, std::endian Endian = std::endian::little>
+        requires std::is_trivially_copyable_v<T>
+    struct Field
+    {
+        using type = T;
+
+        static constexpr std::string_view name = Name.view();
+        static constexpr size_t offset = Offset;
+        static constexpr size_t size = sizeof(T);
+        static constexpr std::endian endian = Endian;
+
+        static T load(const std::byte* record) noexcept
+        {
+            T value;
+            std::memcpy(&value, record + offset, sizeof(T));
+            if constexpr (Endian != std::endian::native && sizeof(T) > 1)
+                value = byteswap(value);
+            return value;
+        }
+
+        static void store(std::byte* record, T value) noexcept
+        {
+            if constexpr (Endian != std::endian::native && sizeof(T) > 1)
+                value = byteswap(value);
+            std::memcpy(record + offset, &value, sizeof(T));
+        }
+    };
+
+    template <typename... TFields>
+    struct Layout
+    {
+        static constexpr size_t size = std::max({size_t{0}, (TFields::offset + TFields::size)...});
+        static constexpr size_t field_count = sizeof...(TFields);
+
+        template <size_t Index>
+        using field = std::tuple_element_t<Index, std::tuple<TFields...>>;
+
+        template <FixedString Name>
+        static constexpr size_t index_of()
+        {
+            constexpr std::array names = {TFields::name...};
+            constexpr auto index = std::ranges::find(names, Name.view()) - names.begin();
+            static_assert(index < sizeof...(TFields), "no such field in layout");
+            return index;
+        }
+
+        template <FixedString Name>
+        using field_t = field<index_of<Name>()>;
+    };
+
+    ///////////////////////////
+    // ByteView - single record
+
+    template <typename TLayout, typename TByte = const std::byte>
+        requires std::same_as<std::remove_const_t<TByte>, std::byte>
+    class ByteView
+    {
+        std::span<TByte> bytes_;
+
+    public:
+        static constexpr size_t size = TLayout::size;
+
+        explicit ByteView(std::span<TByte> bytes)
+            : bytes_{bytes}
+        {
+            assert(bytes_.size() >= TLayout::size); // bounds checked once - field offsets are known at compile time
+        }
+
+        template <FixedString Name>
+        auto get() const noexcept
+        {
+            return TLayout::template field_t<Name>::load(bytes_.data());
+        }
+
+        template <FixedString Name>
+        void set(typename TLayout::template field_t<Name>::type value) noexcept
+            requires(!std::is_const_v<TByte>)
+        {
+            TLayout::template field_t<Name>::store(bytes_.data(), value);
+        }
+
+        std::span<TByte> bytes() const noexcept
+        {
+            return bytes_.first(TLayout::size);
+        }
+    };
+
+    template <typename TLayout>
+    using MutableByteView = ByteView<TLayout, std::byte>;
+
+    // view of the index-th record in a buffer of consecutive records
+    template <typename TLayout, typename TByte>
+    ByteView<TLayout, TByte> record_at(std::span<TByte> records, size_t index, size_t stride = TLayout::size)
+    {
+        assert(index * stride + TLayout::size <= records.size());
+        return ByteView<TLayout, TByte>{records.subspan(index * stride)};
+    }
+
+    ///////////////////////////
+    // SoA decoding of record batches
+
+    template <typename TLayout>
+    class SoaColumns;
+
+    template <typename... TFields>
+    class SoaColumns<Layout<TFields...>>
+    {
+        using TLayout = Layout<TFields...>;
+
+        std::tuple<std::vector<typename TFields::type>...> columns_;
+
+        template <typename TField>
+        static void decode_column(std::vector<typename TField::type>& column, std::span<const std::byte> records, size_t count, size_t stride)
+        {
+            const auto offset = column.size();
+            column.resize(offset + count);
+
+            auto* out = column.data() + offset;
+            const std::byte* record = records.data();
+            for (size_t i = 0; i < count; ++i, record += stride)
+                out[i] = TField::load(record);
+        }
+
+    public:
+        // appends all complete records from the buffer - returns number of decoded records
+        size_t decode(std::span<const std::byte> records, size_t stride = TLayout::size)
+        {
+            assert(stride >= TLayout::size);
+
+            const size_t count = records.size() < TLayout::size ? 0 : (records.size() - TLayout::size) / stride + 1;
+
+            std::apply([&](auto&... column) { (decode_column<TFields>(column, records, count, stride), ...); }, columns_);
+
+            return count;
+        }
+
+        template <FixedString Name>
+        std::span<const typename TLayout::template field_t<Name>::type> column() const noexcept
+        {
+            return std::get<TLayout::template index_of<Name>()>(columns_);
+        }
+
+        size_t size() const noexcept
+        {
+            return std::get<0>(columns_).size();
+        }
+
+        void clear() noexcept
+        {
+            std::apply([](auto&... column) { (column.clear(), ...); }, columns_);
+        }
+    };
+} // namespace Bytes
+
+#endif
@@ -0,0 +1,141 @@
+#include "byte_view.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <span>
+#include <vector>
+
+using namespace std::literals;
+
+using SensorPacket = Bytes::Layout<
+    Bytes::Field<"magic", uint16_t, 0, std::endian::big>,
+    Bytes::Field<"sensor_id", uint32_t, 2, std::endian::little>,
+    Bytes::Field<"temperature", float, 6, std::endian::big>,
+    Bytes::Field<"flags", uint8_t, 10>>;
+
+static_assert(SensorPacket::size == 11);
+static_assert(SensorPacket::index_of<"temperature">() == 2);
+
+TEST_CASE("byteswap")
+{
+    static_assert(Bytes::byteswap(uint16_t{0xCAFE}) == 0xFECA);
+    static_assert(Bytes::byteswap(uint32_t{0x01020304}) == 0x04030201);
+    static_assert(Bytes::byteswap(Bytes::byteswap(3.14)) == 3.14);
+}
+
+TEST_CASE("ByteView - typed access to packed record")
+{
+    const std::byte packet[] = {
+        std::byte{0xCA}, std::byte{0xFE},                                     // magic - big endian
+        std::byte{0x2A}, std::byte{0x00}, std::byte{0x00}, std::byte{0x00},   // sensor_id - little endian
+        std::byte{0x40}, std::byte{0x49}, std::byte{0x0F}, std::byte{0xD0},   // temperature - big endian
+        std::byte{0b101}                                                      // flags
+    };
+
+    Bytes::ByteView<SensorPacket> view{std::span{packet}};
+
+    CHECK(view.get<"magic">() == 0xCAFE);
+    CHECK(view.get<"sensor_id">() == 42);
+    CHECK(view.get<"temperature">() == 3.14159012f);
+    CHECK(view.get<"flags">() == 0b101);
+
+    static_assert(std::is_same_v<decltype(view.get<"temperature">()), float>);
+    // view.get<"pressure">(); // ERROR - no such field in layout
+
+    SECTION("view does not copy the bytes")
+    {
+        CHECK(view.bytes().data() == packet);
+    }
+}
+
+TEST_CASE("MutableByteView - encoding record")
+{
+    std::array<std::byte, SensorPacket::size> buffer{};
+
+    Bytes::MutableByteView<SensorPacket> record{std::span{buffer}};
+    record.set<"magic">(0xCAFE);
+    record.set<"sensor_id">(665);
+    record.set<"temperature">(-12.5f);
+
+    CHECK(buffer[0] == std::byte{0xCA});
+    CHECK(buffer[1] == std::byte{0xFE});
+
+    Bytes::ByteView<SensorPacket> view{std::span<const std::byte>{buffer}};
+    CHECK(view.get<"sensor_id">() == 665);
+    CHECK(view.get<"temperature">() == -12.5f);
+}
+
+namespace
+{
+    std::vector<std::byte> make_packets(size_t count)
+    {
+        std::vector<std::byte> packets(count * SensorPacket::size);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto record = Bytes::record_at<SensorPacket>(std::span{packets}, i);
+            record.set<"magic">(0xCAFE);
+            record.set<"sensor_id">(static_cast<uint32_t>(i));
+            record.set<"temperature">(static_cast<float>(i) / 2);
+            record.set<"flags">(static_cast<uint8_t>(i % 8));
+        }
+
+        return packets;
+    }
+} // namespace
+
+TEST_CASE("SoaColumns - bulk decoding of packet batch")
+{
+    auto packets = make_packets(100);
+
+    Bytes::SoaColumns<SensorPacket> columns;
+    REQUIRE(columns.decode(packets) == 100);
+    REQUIRE(columns.decode(std::span{packets}.first(5 * SensorPacket::size + 3)) == 5); // incomplete record is skipped
+
+    CHECK(columns.size() == 105);
+
+    auto ids = columns.column<"sensor_id">();
+    CHECK(ids[0] == 0);
+    CHECK(ids[99] == 99);
+    CHECK(ids[104] == 4);
+
+    auto temperatures = columns.column<"temperature">();
+    CHECK(temperatures[99] == 49.5f);
+
+    SECTION("records with padding - custom stride")
+    {
+        constexpr size_t stride = 16;
+        std::vector<std::byte> padded(10 * stride);
+        for (size_t i = 0; i < 10; ++i)
+            std::memcpy(padded.data() + i * stride, packets.data() + i * SensorPacket::size, SensorPacket::size);
+
+        Bytes::SoaColumns<SensorPacket> padded_columns;
+        CHECK(padded_columns.decode(padded, stride) == 10);
+        CHECK(padded_columns.column<"temperature">()[9] == 4.5f);
+    }
+}
+
+TEST_CASE("SoaColumns - benchmark", "[.][benchmark]")
+{
+    constexpr size_t n = 1'000'000;
+    auto packets = make_packets(n);
+
+    BENCHMARK("record by record - ByteView")
+    {
+        float sum = 0.0f;
+        for (size_t i = 0; i < n; ++i)
+            sum += Bytes::record_at<SensorPacket>(std::span<const std::byte>{packets}, i).get<"temperature">();
+        return sum;
+    };
+
+    BENCHMARK("SoaColumns::decode + sum of column")
+    {
+        Bytes::SoaColumns<SensorPacket> columns;
+        columns.decode(packets);
+        auto temperatures = columns.column<"temperature">();
+        return std::accumulate(temperatures.begin(), temperatures.end(), 0.0f);
+    };
+}
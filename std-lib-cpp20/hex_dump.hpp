@@ -0,0 +1,262 @@
+#ifndef HEX_DUMP_HPP
+#define HEX_DUMP_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <string_view>
+
+#if __has_include(<format>)
+#include <format>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////
+// Hex encoding & dumps of byte buffers
+//
+// All functions write into caller-provided buffers - nothing is allocated per byte.
+// Encoding uses a 512-entry table of digit pairs (one load + one 2-byte store per byte),
+// decoding uses a 256-entry table and accumulates errors without branching.
+
+namespace Bytes
+{
+    enum class HexCase
+    {
+        upper,
+        lower
+    };
+
+    namespace Detail
+    {
+        constexpr auto make_hex_pairs(std::string_view digits)
+        {
+            std::array<char, 512> pairs{};
+            for (size_t i = 0; i < 256; ++i)
+            {
+                pairs[2 * i] = digits[i >> 4];
+                pairs[2 * i + 1] = digits[i & 0xF];
+            }
+            return pairs;
+        }
+
+        constexpr auto make_hex_values()
+        {
+            std::array<uint8_t, 256> values{};
+            std::ranges::fill(values, 0xFF); // invalid digit marker
+            for (int c = '0'; c <= '9'; ++c)
+                values[c] = static_cast<uint8_t>(c - '0');
+            for (int c = 'a'; c <= 'f'; ++c)
+                values[c] = values[c - 'a' + 'A'] = static_cast<uint8_t>(c - 'a' + 10);
+            return values;
+        }
+
+        inline constexpr auto hex_pairs_upper = make_hex_pairs("0123456789ABCDEF");
+        inline constexpr auto hex_pairs_lower = make_hex_pairs("0123456789abcdef");
+        inline constexpr auto hex_values = make_hex_values();
+
+        inline constexpr const char* hex_pairs(HexCase hex_case)
+        {
+            return hex_case == HexCase::upper ? hex_pairs_upper.data() : hex_pairs_lower.data();
+        }
+
+        inline char printable(std::byte b)
+        {
+            const auto c = std::to_integer<unsigned char>(b);
+            return (c >= 0x20 && c < 0x7F) ? static_cast<char>(c) : '.';
+        }
+    } // namespace Detail
+
+    ///////////////////////////
+    // encoding
+
+    // writes 2 * bytes.size() digits - out must be large enough
+    inline size_t hex_encode(std::span<const std::byte> bytes, std::span<char> out, HexCase hex_case = HexCase::upper)
+    {
+        const char* pairs = Detail::hex_pairs(hex_case);
+        char* dest = out.data();
+
+        for (const std::byte b : bytes)
+        {
+            const char* pair = pairs + 2 * std::to_integer<size_t>(b);
+            dest[0] = pair[0];
+            dest[1] = pair[1];
+            dest += 2;
+        }
+
+        return 2 * bytes.size();
+    }
+
+    // decodes pairs of hex digits - returns number of decoded bytes or nullopt for odd length or invalid digit
+    inline std::optional<size_t> hex_decode(std::string_view hex, std::span<std::byte> out)
+    {
+        if (hex.size() % 2 != 0 || out.size() < hex.size() / 2)
+            return std::nullopt;
+
+        uint8_t invalid = 0;
+        for (size_t i = 0; i < hex.size() / 2; ++i)
+        {
+            const uint8_t hi = Detail::hex_values[static_cast<unsigned char>(hex[2 * i])];
+            const uint8_t lo = Detail::hex_values[static_cast<unsigned char>(hex[2 * i + 1])];
+            invalid |= hi | lo;
+            out[i] = std::byte(static_cast<uint8_t>((hi << 4) | (lo & 0xF)));
+        }
+
+        if (invalid & 0xF0)
+            return std::nullopt;
+
+        return hex.size() / 2;
+    }
+
+    ///////////////////////////
+    // xxd-style dump
+    //
+    // 00000000: 4865 6c6c 6f2c 2057 6f72 6c64 210a 0000  Hello, World!...
+
+    inline constexpr size_t hex_dump_bytes_per_line = 16;
+    inline constexpr size_t hex_dump_line_length = 68;
+
+    constexpr size_t hex_dump_size(size_t bytes_count)
+    {
+        const size_t remainder = bytes_count % hex_dump_bytes_per_line;
+        return (bytes_count / hex_dump_bytes_per_line) * hex_dump_line_length + (remainder ? 52 + remainder : 0);
+    }
+
+    // out must have at least hex_dump_size(bytes.size()) chars - returns number of written chars
+    inline size_t hex_dump(std::span<const std::byte> bytes, std::span<char> out, size_t base_offset = 0)
+    {
+        char* dest = out.data();
+
+        for (size_t line_offset = 0; line_offset < bytes.size(); line_offset += hex_dump_bytes_per_line)
+        {
+            const auto line = bytes.subspan(line_offset, std::min(hex_dump_bytes_per_line, bytes.size() - line_offset));
+
+            const auto offset = base_offset + line_offset;
+            for (int shift = 28, i = 0; shift >= 0; shift -= 4, ++i)
+                dest[i] = Detail::hex_pairs_lower[2 * ((offset >> shift) & 0xF) + 1];
+            dest[8] = ':';
+            dest += 9;
+
+            std::fill_n(dest, 42, ' ');
+            for (size_t i = 0; i < line.size(); ++i)
+            {
+                const char* pair = Detail::hex_pairs_lower.data() + 2 * std::to_integer<size_t>(line[i]);
+                char* digits = dest + 1 + 2 * i + i / 2; // space before every group of 2 bytes
+                digits[0] = pair[0];
+                digits[1] = pair[1];
+            }
+            dest += 42;
+
+            dest = std::ranges::transform(line, dest, Detail::printable).out;
+            *dest++ = '\n';
+        }
+
+        return static_cast<size_t>(dest - out.data());
+    }
+
+    // streams dump of large buffers in chunks through a fixed stack buffer
+    inline void write_hex_dump(std::ostream& out, std::span<const std::byte> bytes)
+    {
+        constexpr size_t lines_per_chunk = 64;
+        constexpr size_t chunk_size = lines_per_chunk * hex_dump_bytes_per_line;
+
+        std::array<char, lines_per_chunk * hex_dump_line_length> buffer;
+
+        for (size_t offset = 0; offset < bytes.size(); offset += chunk_size)
+        {
+            const auto chunk = bytes.subspan(offset, std::min(chunk_size, bytes.size() - offset));
+            out.write(buffer.data(), static_cast<std::streamsize>(hex_dump(chunk, buffer, offset)));
+        }
+    }
+
+    ///////////////////////////
+    // formatting: std::format("{}", Bytes::hex(bytes)) -> "CA FE 00"
+    //   {:x} - lowercase digits, {:X} - uppercase (default), {:p} / {:xp} - packed digits without spaces
+
+    struct HexBytes
+    {
+        std::span<const std::byte> bytes;
+    };
+
+    inline HexBytes hex(std::span<const std::byte> bytes)
+    {
+        return {bytes};
+    }
+} // namespace Bytes
+
+#if __has_include(<format>)
+
+template <>
+struct std::formatter<Bytes::HexBytes>
+{
+    Bytes::HexCase hex_case = Bytes::HexCase::upper;
+    bool packed = false;
+
+    constexpr auto parse(std::format_parse_context& ctx)
+    {
+        auto it = ctx.begin();
+        for (; it != ctx.end() && *it != '}'; ++it)
+        {
+            switch (*it)
+            {
+            case 'x':
+                hex_case = Bytes::HexCase::lower;
+                break;
+            case 'X':
+                hex_case = Bytes::HexCase::upper;
+                break;
+            case 'p':
+                packed = true;
+                break;
+            default:
+                throw std::format_error("invalid format for Bytes::HexBytes");
+            }
+        }
+        return it;
+    }
+
+    template <typename TFormatContext>
+    auto format(const Bytes::HexBytes& hex_bytes, TFormatContext& ctx) const
+    {
+        constexpr size_t chunk_size = 256;
+        std::array<char, 3 * chunk_size> buffer;
+
+        auto out = ctx.out();
+        const auto bytes = hex_bytes.bytes;
+
+        for (size_t offset = 0; offset < bytes.size(); offset += chunk_size)
+        {
+            const auto chunk = bytes.subspan(offset, std::min(chunk_size, bytes.size() - offset));
+
+            if (packed)
+            {
+                const auto length = Bytes::hex_encode(chunk, buffer, hex_case);
+                out = std::copy_n(buffer.data(), length, out);
+            }
+            else
+            {
+                const char* pairs = Bytes::Detail::hex_pairs(hex_case);
+                char* dest = buffer.data();
+                for (const std::byte b : chunk)
+                {
+                    const char* pair = pairs + 2 * std::to_integer<size_t>(b);
+                    dest[0] = ' ';
+                    dest[1] = pair[0];
+                    dest[2] = pair[1];
+                    dest += 3;
+                }
+
+                const char* first = buffer.data() + (offset == 0 ? 1 : 0); // no leading space
+                out = std::copy(first, static_cast<const char*>(dest), out);
+            }
+        }
+
+        return out;
+    }
+};
+
+#endif
+
+#endif
@@ -0,0 +1,132 @@
+#include "hex_dump.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdio>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    std::span<const std::byte> as_bytes(std::string_view text)
+    {
+        return std::as_bytes(std::span{text});
+    }
+} // namespace
+
+TEST_CASE("hex encoding")
+{
+    const std::array data = {std::byte{0xCA}, std::byte{0xFE}, std::byte{0x00}, std::byte{0x7F}};
+
+    std::array<char, 8> buffer;
+
+    SECTION("upper case")
+    {
+        CHECK(Bytes::hex_encode(data, buffer) == 8);
+        CHECK(std::string_view{buffer.data(), 8} == "CAFE007F");
+    }
+
+    SECTION("lower case")
+    {
+        Bytes::hex_encode(data, buffer, Bytes::HexCase::lower);
+        CHECK(std::string_view{buffer.data(), 8} == "cafe007f");
+    }
+}
+
+TEST_CASE("hex decoding")
+{
+    std::array<std::byte, 4> decoded{};
+
+    CHECK(Bytes::hex_decode("CAfe007F", decoded) == 4);
+    CHECK(decoded == std::array{std::byte{0xCA}, std::byte{0xFE}, std::byte{0x00}, std::byte{0x7F}});
+
+    CHECK(Bytes::hex_decode("CAF", decoded) == std::nullopt);  // odd length
+    CHECK(Bytes::hex_decode("CAFG", decoded) == std::nullopt); // invalid digit
+    CHECK(Bytes::hex_decode("CAFE007F00", decoded) == std::nullopt); // output too small
+
+    SECTION("round trip of all byte values")
+    {
+        std::array<std::byte, 256> all_bytes;
+        for (size_t i = 0; i < all_bytes.size(); ++i)
+            all_bytes[i] = std::byte(i);
+
+        std::array<char, 512> hex;
+        Bytes::hex_encode(all_bytes, hex);
+
+        std::array<std::byte, 256> result;
+        CHECK(Bytes::hex_decode({hex.data(), hex.size()}, result) == 256);
+        CHECK(result == all_bytes);
+    }
+}
+
+TEST_CASE("xxd-style hex dump")
+{
+    const auto text = as_bytes("Hello, World!\n\0\0Bye"sv);
+
+    std::string dump(Bytes::hex_dump_size(text.size()), '?');
+    CHECK(Bytes::hex_dump(text, dump) == dump.size());
+
+    CHECK(dump == "00000000: 4865 6c6c 6f2c 2057 6f72 6c64 210a 0000  Hello, World!...\n"
+                  "00000010: 4279 65                                  Bye\n");
+
+    SECTION("streaming dump")
+    {
+        std::vector<std::byte> large(5000);
+        std::iota(reinterpret_cast<unsigned char*>(large.data()), reinterpret_cast<unsigned char*>(large.data() + large.size()), 0);
+
+        std::ostringstream out;
+        Bytes::write_hex_dump(out, large);
+
+        std::string expected(Bytes::hex_dump_size(large.size()), '?');
+        Bytes::hex_dump(large, expected);
+
+        CHECK(out.str() == expected);
+        CHECK(out.str().substr(4096 / 16 * Bytes::hex_dump_line_length, 10) == "00001000: ");
+    }
+}
+
+#if __has_include(<format>)
+TEST_CASE("formatting bytes")
+{
+    const std::array data = {std::byte{0xCA}, std::byte{0xFE}, std::byte{0x0A}};
+
+    CHECK(std::format("{}", Bytes::hex(data)) == "CA FE 0A");
+    CHECK(std::format("{:x}", Bytes::hex(data)) == "ca fe 0a");
+    CHECK(std::format("{:p}", Bytes::hex(data)) == "CAFE0A");
+    CHECK(std::format("[{}]", Bytes::hex({})) == "[]");
+}
+#endif
+
+TEST_CASE("hex dump - benchmark", "[.][benchmark]")
+{
+    std::vector<std::byte> data(4 * 1024 * 1024);
+    std::iota(reinterpret_cast<unsigned char*>(data.data()), reinterpret_cast<unsigned char*>(data.data() + data.size()), 0);
+
+    std::string hex(2 * data.size(), ' ');
+    std::string dump(Bytes::hex_dump_size(data.size()), ' ');
+
+    BENCHMARK("snprintf per byte")
+    {
+        char* dest = hex.data();
+        for (const std::byte b : data)
+        {
+            std::snprintf(dest, 3, "%02X", std::to_integer<int>(b));
+            dest += 2;
+        }
+        return hex.data();
+    };
+
+    BENCHMARK("hex_encode")
+    {
+        return Bytes::hex_encode(data, hex);
+    };
+
+    BENCHMARK("hex_dump")
+    {
+        return Bytes::hex_dump(data, dump);
+    };
+}
@@ -1,3 +1,5 @@
+#include "hex_dump.hpp"
+
 #include <catch2/catch_test_macros.hpp>
 #include <iostream>
 #include <span>
@@ -67,14 +69,7 @@ TEST_CASE("std::span")
 
 void print_as_bytes(const float f, const std::span<const std::byte> bytes)
 {
-	std::cout << std::format("{:+6}", f) << " - { ";
-
-	for(const std::byte b : bytes)
-	{
-		std::cout << std::format("{:02X} ", std::to_integer<int>(b));
-	}
-
-	std::cout << "}\n";
+	std::cout << std::format("{:+6} - {{ {} }}\n", f, Bytes::hex(bytes)); // one format call - no string per byte
 }
 
 TEST_CASE("span of bytes")
@@ -0,0 +1,504 @@
+#ifndef STRIDED_SPAN_HPP
+#define STRIDED_SPAN_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <tuple>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////////////////////
+// StridedSpan - mdspan-like multidimensional view of a contiguous buffer
+//
+// StridedSpan<float, Extents<3, 4>> m1{data_ptr};                                    // static extents
+// StridedSpan<float, DynamicExtents<2>, LayoutLeft> m2{data_span, rows, cols};        // column-major
+// StridedSpan<float, DynamicExtents<2>, LayoutTiled<16, 16>> m3{data_span, rows, cols}; // blocked layout
+//
+// Every layout provides for_each_index(f), which visits indices in memory order - kernels
+// written on top of it (copy, stencils) walk through memory sequentially for any layout.
+
+namespace Numeric
+{
+    inline constexpr size_t dynamic_extent = std::dynamic_extent;
+
+    ///////////////////////////
+    // Extents
+
+    template <size_t... Exts>
+    class Extents
+    {
+        static constexpr std::array<size_t, sizeof...(Exts)> static_extents_ = {Exts...};
+
+        std::array<size_t, sizeof...(Exts)> extents_ = {Exts...};
+
+    public:
+        static constexpr size_t rank()
+        {
+            return sizeof...(Exts);
+        }
+
+        static constexpr size_t rank_dynamic()
+        {
+            return ((Exts == dynamic_extent) + ... + 0);
+        }
+
+        static constexpr size_t static_extent(size_t r)
+        {
+            return static_extents_[r];
+        }
+
+        constexpr Extents()
+            requires(rank_dynamic() == 0)
+        = default;
+
+        // values for dynamic extents only
+        template <std::convertible_to<size_t>... TDynamicExtents>
+            requires(sizeof...(TDynamicExtents) == rank_dynamic() && rank_dynamic() > 0)
+        constexpr explicit Extents(TDynamicExtents... dynamic_extents)
+        {
+            const std::array<size_t, rank_dynamic()> values = {static_cast<size_t>(dynamic_extents)...};
+            for (size_t r = 0, d = 0; r < rank(); ++r)
+            {
+                if (static_extents_[r] == dynamic_extent)
+                    extents_[r] = values[d++];
+            }
+        }
+
+        constexpr size_t extent(size_t r) const
+        {
+            return extents_[r];
+        }
+
+        constexpr size_t size() const
+        {
+            size_t result = 1;
+            for (auto e : extents_)
+                result *= e;
+            return result;
+        }
+
+        friend constexpr bool operator==(const Extents&, const Extents&) = default;
+    };
+
+    namespace Detail
+    {
+        template <size_t Rank, size_t... Is>
+        constexpr auto make_dynamic_extents(std::index_sequence<Is...>) -> Extents<((void)Is, dynamic_extent)...>;
+
+        template <typename TExtents, typename F>
+        constexpr void for_each_index_in_order(const TExtents& extents, const std::array<size_t, TExtents::rank()>& order, F&& f)
+        {
+            // order[0] - outermost dimension, order[rank-1] - innermost (contiguous) dimension
+            constexpr size_t rank = TExtents::rank();
+
+            if (extents.size() == 0)
+                return;
+
+            if constexpr (rank == 2)
+            {
+                std::array<size_t, 2> idx{};
+                for (idx[order[0]] = 0; idx[order[0]] < extents.extent(order[0]); ++idx[order[0]])
+                    for (idx[order[1]] = 0; idx[order[1]] < extents.extent(order[1]); ++idx[order[1]])
+                        f(idx[0], idx[1]);
+            }
+            else
+            {
+                std::array<size_t, rank> idx{};
+                while (true)
+                {
+                    std::apply(f, idx);
+
+                    size_t d = rank;
+                    while (d > 0)
+                    {
+                        const size_t dim = order[d - 1];
+                        if (++idx[dim] < extents.extent(dim))
+                            break;
+                        idx[dim] = 0;
+                        --d;
+                    }
+                    if (d == 0)
+                        return;
+                }
+            }
+        }
+    } // namespace Detail
+
+    template <size_t Rank>
+    using DynamicExtents = decltype(Detail::make_dynamic_extents<Rank>(std::make_index_sequence<Rank>{}));
+
+    ///////////////////////////
+    // layouts
+
+    // row-major - last index is contiguous
+    struct LayoutRight
+    {
+        template <typename TExtents>
+        class mapping
+        {
+            TExtents extents_;
+
+        public:
+            constexpr mapping() = default;
+
+            constexpr explicit mapping(const TExtents& extents)
+                : extents_{extents}
+            {
+            }
+
+            constexpr const TExtents& extents() const
+            {
+                return extents_;
+            }
+
+            constexpr size_t operator()(std::convertible_to<size_t> auto... idx) const
+            {
+                static_assert(sizeof...(idx) == TExtents::rank());
+                size_t offset = 0;
+                size_t r = 0;
+                ((offset = offset * extents_.extent(r++) + static_cast<size_t>(idx)), ...);
+                return offset;
+            }
+
+            constexpr size_t stride(size_t r) const
+            {
+                size_t result = 1;
+                for (size_t i = r + 1; i < TExtents::rank(); ++i)
+                    result *= extents_.extent(i);
+                return result;
+            }
+
+            constexpr size_t required_span_size() const
+            {
+                return extents_.size();
+            }
+
+            template <typename F>
+            constexpr void for_each_index(F&& f) const
+            {
+                std::array<size_t, TExtents::rank()> order;
+                for (size_t r = 0; r < order.size(); ++r)
+                    order[r] = r;
+                Detail::for_each_index_in_order(extents_, order, std::forward<F>(f));
+            }
+        };
+    };
+
+    // column-major - first index is contiguous
+    struct LayoutLeft
+    {
+        template <typename TExtents>
+        class mapping
+        {
+            TExtents extents_;
+
+        public:
+            constexpr mapping() = default;
+
+            constexpr explicit mapping(const TExtents& extents)
+                : extents_{extents}
+            {
+            }
+
+            constexpr const TExtents& extents() const
+            {
+                return extents_;
+            }
+
+            constexpr size_t operator()(std::convertible_to<size_t> auto... idx) const
+            {
+                static_assert(sizeof...(idx) == TExtents::rank());
+                const std::array<size_t, TExtents::rank()> indexes = {static_cast<size_t>(idx)...};
+                size_t offset = 0;
+                for (size_t r = TExtents::rank(); r > 0; --r)
+                    offset = offset * extents_.extent(r - 1) + indexes[r - 1];
+                return offset;
+            }
+
+            constexpr size_t stride(size_t r) const
+            {
+                size_t result = 1;
+                for (size_t i = 0; i < r; ++i)
+                    result *= extents_.extent(i);
+                return result;
+            }
+
+            constexpr size_t required_span_size() const
+            {
+                return extents_.size();
+            }
+
+            template <typename F>
+            constexpr void for_each_index(F&& f) const
+            {
+                std::array<size_t, TExtents::rank()> order;
+                for (size_t r = 0; r < order.size(); ++r)
+                    order[r] = order.size() - 1 - r;
+                Detail::for_each_index_in_order(extents_, order, std::forward<F>(f));
+            }
+        };
+    };
+
+    // arbitrary strides (e.g. every n-th column, sub-matrix of a larger buffer)
+    struct LayoutStride
+    {
+        template <typename TExtents>
+        class mapping
+        {
+            TExtents extents_;
+            std::array<size_t, TExtents::rank()> strides_{};
+
+        public:
+            constexpr mapping() = default;
+
+            constexpr mapping(const TExtents& extents, const std::array<size_t, TExtents::rank()>& strides)
+                : extents_{extents}, strides_{strides}
+            {
+            }
+
+            constexpr const TExtents& extents() const
+            {
+                return extents_;
+            }
+
+            constexpr size_t operator()(std::convertible_to<size_t> auto... idx) const
+            {
+                static_assert(sizeof...(idx) == TExtents::rank());
+                size_t offset = 0;
+                size_t r = 0;
+                ((offset += static_cast<size_t>(idx) * strides_[r++]), ...);
+                return offset;
+            }
+
+            constexpr size_t stride(size_t r) const
+            {
+                return strides_[r];
+            }
+
+            constexpr size_t required_span_size() const
+            {
+                if (extents_.size() == 0)
+                    return 0;
+
+                size_t result = 1;
+                for (size_t r = 0; r < TExtents::rank(); ++r)
+                    result += (extents_.extent(r) - 1) * strides_[r];
+                return result;
+            }
+
+            template <typename F>
+            constexpr void for_each_index(F&& f) const
+            {
+                std::array<size_t, TExtents::rank()> order;
+                for (size_t r = 0; r < order.size(); ++r)
+                    order[r] = r;
+                std::ranges::sort(order, std::greater{}, [this](size_t r) { return strides_[r]; }); // largest stride outermost
+                Detail::for_each_index_in_order(extents_, order, std::forward<F>(f));
+            }
+        };
+    };
+
+    // 2D blocked layout - matrix is stored as row-major grid of row-major TileRows x TileCols tiles
+    // (partial tiles at the edges are padded)
+    template <size_t TileRows, size_t TileCols = TileRows>
+    struct LayoutTiled
+    {
+        template <typename TExtents>
+            requires(TExtents::rank() == 2)
+        class mapping
+        {
+            TExtents extents_;
+            size_t tiles_per_row_ = 0;
+
+            static constexpr size_t tile_size = TileRows * TileCols;
+
+        public:
+            constexpr mapping() = default;
+
+            constexpr explicit mapping(const TExtents& extents)
+                : extents_{extents}, tiles_per_row_{(extents.extent(1) + TileCols - 1) / TileCols}
+            {
+            }
+
+            constexpr const TExtents& extents() const
+            {
+                return extents_;
+            }
+
+            constexpr size_t operator()(std::convertible_to<size_t> auto row, std::convertible_to<size_t> auto col) const
+            {
+                const auto i = static_cast<size_t>(row);
+                const auto j = static_cast<size_t>(col);
+                return ((i / TileRows) * tiles_per_row_ + j / TileCols) * tile_size + (i % TileRows) * TileCols + j % TileCols;
+            }
+
+            constexpr size_t required_span_size() const
+            {
+                const size_t tile_rows_count = (extents_.extent(0) + TileRows - 1) / TileRows;
+                return tile_rows_count * tiles_per_row_ * tile_size;
+            }
+
+            template <typename F>
+            constexpr void for_each_index(F&& f) const
+            {
+                const size_t rows = extents_.extent(0);
+                const size_t cols = extents_.extent(1);
+
+                for (size_t tile_i = 0; tile_i < rows; tile_i += TileRows)
+                    for (size_t tile_j = 0; tile_j < cols; tile_j += TileCols)
+                        for (size_t i = tile_i; i < std::min(tile_i + TileRows, rows); ++i)
+                            for (size_t j = tile_j; j < std::min(tile_j + TileCols, cols); ++j)
+                                f(i, j);
+            }
+        };
+    };
+
+    ///////////////////////////
+    // StridedSpan
+
+    template <typename T, typename TExtents, typename TLayout = LayoutRight>
+    class StridedSpan
+    {
+    public:
+        using element_type = T;
+        using extents_type = TExtents;
+        using layout_type = TLayout;
+        using mapping_type = typename TLayout::template mapping<TExtents>;
+
+    private:
+        T* data_ = nullptr;
+        mapping_type mapping_;
+
+    public:
+        constexpr StridedSpan() = default;
+
+        constexpr StridedSpan(T* data, const mapping_type& mapping)
+            : data_{data}, mapping_{mapping}
+        {
+        }
+
+        template <typename U>
+            requires std::convertible_to<U*, T*>
+        constexpr StridedSpan(const StridedSpan<U, TExtents, TLayout>& other)
+            : data_{other.data()}, mapping_{other.mapping()}
+        {
+        }
+
+        constexpr explicit StridedSpan(T* data)
+            requires(TExtents::rank_dynamic() == 0)
+            : data_{data}, mapping_{TExtents{}}
+        {
+        }
+
+        constexpr StridedSpan(T* data, const TExtents& extents)
+            requires std::constructible_from<mapping_type, const TExtents&>
+            : data_{data}, mapping_{extents}
+        {
+        }
+
+        template <std::convertible_to<size_t>... TDynamicExtents>
+            requires std::constructible_from<TExtents, TDynamicExtents...> && std::constructible_from<mapping_type, const TExtents&>
+        constexpr StridedSpan(std::span<T> buffer, TDynamicExtents... dynamic_extents)
+            : data_{buffer.data()}, mapping_{TExtents{dynamic_extents...}}
+        {
+            assert(buffer.size() >= mapping_.required_span_size());
+        }
+
+        static constexpr size_t rank()
+        {
+            return TExtents::rank();
+        }
+
+        constexpr size_t extent(size_t r) const
+        {
+            return mapping_.extents().extent(r);
+        }
+
+        constexpr const TExtents& extents() const
+        {
+            return mapping_.extents();
+        }
+
+        constexpr size_t size() const
+        {
+            return mapping_.extents().size();
+        }
+
+        constexpr T* data() const
+        {
+            return data_;
+        }
+
+        constexpr const mapping_type& mapping() const
+        {
+            return mapping_;
+        }
+
+        constexpr T& operator()(std::convertible_to<size_t> auto... idx) const
+        {
+            static_assert(sizeof...(idx) == rank());
+#ifndef NDEBUG
+            size_t r = 0;
+            assert(((static_cast<size_t>(idx) < extent(r++)) && ...));
+#endif
+            return data_[mapping_(idx...)];
+        }
+
+        // visits all indexes in memory order of the layout
+        template <typename F>
+        constexpr void for_each_index(F&& f) const
+        {
+            mapping_.for_each_index(std::forward<F>(f));
+        }
+    };
+
+    ///////////////////////////
+    // kernels
+
+    // dest(i, j) = src(j, i) - walks dest in its memory order (src reads are strided)
+    template <typename TSrcSpan, typename TDestSpan>
+    constexpr void transpose(TSrcSpan src, TDestSpan dest)
+    {
+        assert(src.extent(0) == dest.extent(1) && src.extent(1) == dest.extent(0));
+        dest.for_each_index([&](size_t i, size_t j) { dest(i, j) = src(j, i); });
+    }
+
+    // transpose in Block x Block squares - both src and dest blocks stay in cache
+    template <size_t Block = 32, typename TSrcSpan, typename TDestSpan>
+    constexpr void transpose_blocked(TSrcSpan src, TDestSpan dest)
+    {
+        assert(src.extent(0) == dest.extent(1) && src.extent(1) == dest.extent(0));
+
+        const size_t rows = dest.extent(0);
+        const size_t cols = dest.extent(1);
+
+        for (size_t bi = 0; bi < rows; bi += Block)
+            for (size_t bj = 0; bj < cols; bj += Block)
+                for (size_t i = bi; i < std::min(bi + Block, rows); ++i)
+                    for (size_t j = bj; j < std::min(bj + Block, cols); ++j)
+                        dest(i, j) = src(j, i);
+    }
+
+    // 5-point stencil on inner points: dest(i, j) = f(center, north, south, west, east)
+    template <typename TSrcSpan, typename TDestSpan, typename F>
+    constexpr void stencil_5pt(TSrcSpan src, TDestSpan dest, F&& f)
+    {
+        assert(src.extents() == dest.extents());
+
+        const size_t rows = src.extent(0);
+        const size_t cols = src.extent(1);
+
+        dest.for_each_index([&](size_t i, size_t j) {
+            if (i == 0 || j == 0 || i == rows - 1 || j == cols - 1)
+                dest(i, j) = src(i, j);
+            else
+                dest(i, j) = f(src(i, j), src(i - 1, j), src(i + 1, j), src(i, j - 1), src(i, j + 1));
+        });
+    }
+} // namespace Numeric
+
+#endif
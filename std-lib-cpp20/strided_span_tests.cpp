@@ -0,0 +1,233 @@
+#include "strided_span.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <numeric>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("StridedSpan - static extents")
+{
+    int data[12];
+    std::iota(std::begin(data), std::end(data), 0);
+
+    Numeric::StridedSpan<int, Numeric::Extents<3, 4>> m{data};
+
+    static_assert(decltype(m)::rank() == 2);
+    static_assert(Numeric::Extents<3, 4>::rank_dynamic() == 0);
+    static_assert(sizeof(Numeric::Extents<3, 4>) == 2 * sizeof(size_t));
+
+    CHECK(m.extent(0) == 3);
+    CHECK(m.extent(1) == 4);
+    CHECK(m(0, 0) == 0);
+    CHECK(m(1, 2) == 6);
+    CHECK(m(2, 3) == 11);
+}
+
+TEST_CASE("StridedSpan - layouts")
+{
+    std::vector<int> buffer(6);
+    std::iota(buffer.begin(), buffer.end(), 0);
+
+    SECTION("row-major")
+    {
+        Numeric::StridedSpan<int, Numeric::DynamicExtents<2>> m{std::span{buffer}, 2, 3};
+
+        CHECK(m(0, 2) == 2);
+        CHECK(m(1, 0) == 3);
+        CHECK(m.mapping().stride(0) == 3);
+    }
+
+    SECTION("column-major")
+    {
+        Numeric::StridedSpan<int, Numeric::DynamicExtents<2>, Numeric::LayoutLeft> m{std::span{buffer}, 2, 3};
+
+        CHECK(m(0, 2) == 4);
+        CHECK(m(1, 0) == 1);
+        CHECK(m.mapping().stride(1) == 2);
+    }
+
+    SECTION("mixed static & dynamic extents")
+    {
+        Numeric::StridedSpan<int, Numeric::Extents<Numeric::dynamic_extent, 3>> m{std::span{buffer}, 2};
+
+        CHECK(m.extent(0) == 2);
+        CHECK(m(1, 1) == 4);
+    }
+
+    SECTION("strided - every second column")
+    {
+        using Mapping = Numeric::LayoutStride::mapping<Numeric::DynamicExtents<2>>;
+        Numeric::StridedSpan<int, Numeric::DynamicExtents<2>, Numeric::LayoutStride> m{buffer.data(), Mapping{Numeric::DynamicExtents<2>{2, 2}, {3, 2}}};
+
+        CHECK(m(0, 1) == 2);
+        CHECK(m(1, 1) == 5);
+        CHECK(m.mapping().required_span_size() == 6);
+    }
+
+    SECTION("3D")
+    {
+        std::vector<int> cube(24);
+        std::iota(cube.begin(), cube.end(), 0);
+        Numeric::StridedSpan<int, Numeric::Extents<2, 3, 4>> m{cube.data()};
+
+        CHECK(m(1, 2, 3) == 23);
+        CHECK(m(1, 0, 2) == 14);
+
+        std::vector<int> visited;
+        m.for_each_index([&](size_t i, size_t j, size_t k) { visited.push_back(m(i, j, k)); });
+        CHECK(visited == cube);
+    }
+}
+
+TEST_CASE("StridedSpan - tiled layout")
+{
+    using Tiled = Numeric::LayoutTiled<2, 2>;
+    using Mapping = Tiled::mapping<Numeric::DynamicExtents<2>>;
+
+    const Mapping mapping{Numeric::DynamicExtents<2>{3, 5}};
+
+    CHECK(mapping.required_span_size() == 4 * 2 * 3); // padded to 4x6
+    CHECK(mapping(0, 0) == 0);
+    CHECK(mapping(0, 1) == 1);
+    CHECK(mapping(1, 0) == 2);
+    CHECK(mapping(1, 1) == 3);
+    CHECK(mapping(0, 2) == 4);
+    CHECK(mapping(2, 0) == 12);
+
+    SECTION("for_each_index visits in memory order")
+    {
+        size_t expected_offset = 0;
+        bool ordered = true;
+        mapping.for_each_index([&](size_t i, size_t j) {
+            if (i != 2 && j != 4) // skip edges with padding
+                ordered = ordered && mapping(i, j) == expected_offset++;
+        });
+        CHECK(ordered);
+    }
+}
+
+namespace
+{
+    constexpr int transposed_checksum()
+    {
+        std::array<int, 9> src{1, 2, 3, 4, 5, 6, 7, 8, 9};
+        std::array<int, 9> dest{};
+
+        using E = Numeric::Extents<3, 3>;
+        Numeric::StridedSpan<const int, E> m_src{src.data(), E{}};
+        Numeric::StridedSpan<int, E, Numeric::LayoutLeft> m_dest{dest.data(), E{}};
+
+        Numeric::transpose(m_src, m_dest);
+
+        return m_dest(0, 1) * 100 + dest[1];
+    }
+} // namespace
+
+TEST_CASE("StridedSpan - constexpr")
+{
+    static_assert(transposed_checksum() == 4 * 100 + 2); // dest(0, 1) == src(1, 0), dest[1] is dest(1, 0) in column-major layout
+}
+
+TEST_CASE("transpose & stencil kernels")
+{
+    constexpr size_t rows = 37;
+    constexpr size_t cols = 50;
+
+    std::vector<int> src_buffer(rows * cols);
+    std::iota(src_buffer.begin(), src_buffer.end(), 0);
+    Numeric::StridedSpan<const int, Numeric::DynamicExtents<2>> src{std::span<const int>{src_buffer}, rows, cols};
+
+    std::vector<int> naive_buffer(rows * cols);
+    Numeric::StridedSpan<int, Numeric::DynamicExtents<2>> naive{std::span{naive_buffer}, cols, rows};
+    Numeric::transpose(src, naive);
+
+    CHECK(naive(3, 7) == src(7, 3));
+
+    SECTION("blocked transpose")
+    {
+        std::vector<int> blocked_buffer(rows * cols);
+        Numeric::StridedSpan<int, Numeric::DynamicExtents<2>> blocked{std::span{blocked_buffer}, cols, rows};
+        Numeric::transpose_blocked<8>(src, blocked);
+
+        CHECK(blocked_buffer == naive_buffer);
+    }
+
+    SECTION("transpose into tiled layout")
+    {
+        using Tiled = Numeric::LayoutTiled<8, 8>;
+        std::vector<int> tiled_buffer(Tiled::mapping<Numeric::DynamicExtents<2>>{Numeric::DynamicExtents<2>{cols, rows}}.required_span_size());
+        Numeric::StridedSpan<int, Numeric::DynamicExtents<2>, Tiled> tiled{std::span{tiled_buffer}, cols, rows};
+        Numeric::transpose(src, tiled);
+
+        bool all_equal = true;
+        naive.for_each_index([&](size_t i, size_t j) { all_equal = all_equal && naive(i, j) == tiled(i, j); });
+        CHECK(all_equal);
+    }
+
+    SECTION("stencil")
+    {
+        std::vector<int> dest_buffer(rows * cols);
+        Numeric::StridedSpan<int, Numeric::DynamicExtents<2>> dest{std::span{dest_buffer}, rows, cols};
+
+        Numeric::stencil_5pt(src, dest, [](int c, int n, int s, int w, int e) { return 4 * c - n - s - w - e; });
+
+        CHECK(dest(0, 0) == src(0, 0));
+        CHECK(dest(10, 10) == 0); // laplacian of linear function
+    }
+}
+
+TEST_CASE("StridedSpan - benchmark", "[.][benchmark]")
+{
+    constexpr size_t n = 2048;
+
+    std::vector<float> src_buffer(n * n);
+    std::iota(src_buffer.begin(), src_buffer.end(), 0.0f);
+    std::vector<float> dest_buffer(n * n);
+
+    using Extents = Numeric::DynamicExtents<2>;
+    using Tiled = Numeric::LayoutTiled<32, 32>;
+
+    Numeric::StridedSpan<const float, Extents> src{std::span<const float>{src_buffer}, n, n};
+    Numeric::StridedSpan<float, Extents> dest{std::span{dest_buffer}, n, n};
+
+    std::vector<float> tiled_src_buffer(n * n);
+    Numeric::StridedSpan<float, Extents, Tiled> tiled_src{std::span{tiled_src_buffer}, n, n};
+    tiled_src.for_each_index([&](size_t i, size_t j) { tiled_src(i, j) = src(i, j); });
+
+    std::vector<float> tiled_dest_buffer(n * n);
+    Numeric::StridedSpan<float, Extents, Tiled> tiled_dest{std::span{tiled_dest_buffer}, n, n};
+
+    BENCHMARK("transpose - naive")
+    {
+        Numeric::transpose(src, dest);
+        return dest_buffer.data();
+    };
+
+    BENCHMARK("transpose - blocked traversal")
+    {
+        Numeric::transpose_blocked<32>(src, dest);
+        return dest_buffer.data();
+    };
+
+    BENCHMARK("transpose - tiled layouts")
+    {
+        Numeric::transpose(Numeric::StridedSpan<const float, Extents, Tiled>{tiled_src}, tiled_dest);
+        return tiled_dest_buffer.data();
+    };
+
+    auto laplacian = [](float c, float n, float s, float w, float e) { return 4 * c - n - s - w - e; };
+
+    BENCHMARK("stencil - row-major")
+    {
+        Numeric::stencil_5pt(src, dest, laplacian);
+        return dest_buffer.data();
+    };
+
+    BENCHMARK("stencil - tiled")
+    {
+        Numeric::stencil_5pt(Numeric::StridedSpan<const float, Extents, Tiled>{tiled_src}, tiled_dest, laplacian);
+        return tiled_dest_buffer.data();
+    };
+}